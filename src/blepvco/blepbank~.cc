@@ -0,0 +1,368 @@
+/* blepvco - minBLEP-based, hard-sync-capable LADSPA VCOs.
+ *
+ * Copyright (C) 2004-2005 Sean Bolton.
+ * Copyright (C) 2017-2018 Jean-Pierre Cimalando.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA 02111-1307, USA.
+ */
+
+// Implementation notes
+//     oscillators are the same as bleprect~ and blepsaw~, without hard sync
+//     state is held as structure of arrays, the voices advance in lockstep
+//     voices are grouped by 8, each group having its minBLEP buffers interleaved
+
+#include "blepvco/blepvco.h"
+#include "blepvco/minblep_tables.h"
+#include "util/pd++.h"
+#include <jsl/dynarray>
+#include <jsl/math>
+#include <jsl/types>
+#include <algorithm>
+#include <initializer_list>
+#include <cstring>
+
+enum e_blepbank_shape {
+    shape_rect, shape_saw,
+};
+static constexpr const char *blepbank_shape_name[] = {
+    "rect", "saw",
+};
+static constexpr uint blepbank_shape_count =
+    sizeof(blepbank_shape_name) / sizeof(blepbank_shape_name[0]);
+static constexpr uint blepbank_max_count = 64;
+// voices are processed in groups of this size, and the bank padded to it
+static constexpr uint blepbank_lanes = 8;
+
+//------------------------------------------------------------------------------
+struct t_blepbank : pd_basic_object<t_blepbank> {
+    t_float x_signalin = 0;
+    e_blepbank_shape x_shape = shape_rect;
+    uint x_nvoices = 0;
+    pd_dynarray<t_float> x_p;
+    pd_dynarray<t_float> x_w;
+    pd_dynarray<t_float> x_b;
+    pd_dynarray<t_float> x_x;
+    pd_dynarray<t_float> x_z;
+    pd_dynarray<t_float> x_dw;
+    pd_dynarray<t_float> x_db;
+    pd_dynarray<int> x_k;
+    pd_dynarray<int> x_edge;
+    pd_dynarray<t_float> x_dph;
+    pd_dynarray<t_float> x_f;
+    pd_dynarray<step_dd_event> x_events;
+    int x_j = 0;
+    t_float x_wave = 0;
+    t_float x_lpfilt = 0.5;
+    bool x_init = false;
+    pd_dynarray<u_inlet> x_inl_freq;
+    pd_dynarray<u_outlet> x_otl_outp;
+};
+
+static e_blepbank_shape blepbank_shapeof(t_symbol *s, bool *ok)
+{
+    for (uint i = 0; i < blepbank_shape_count; ++i) {
+        if (s == gensym(blepbank_shape_name[i])) {
+            *ok = true;
+            return (e_blepbank_shape)i;
+        }
+    }
+    *ok = false;
+    return shape_rect;
+}
+
+static void *blepbank_new(t_symbol *s, int argc, t_atom argv[])
+{
+    u_pd<t_blepbank> x;
+
+    try {
+        x = pd_make_instance<t_blepbank>();
+
+        uint nvoices = 1;
+        e_blepbank_shape shape = shape_rect;
+        bool ok = true;
+
+        switch (argc) {
+        case 2: shape = blepbank_shapeof(atom_getsymbolarg(1, argc, argv), &ok);  // fall through
+        case 1: nvoices = (int)atom_getfloat(&argv[0]);  // fall through
+        case 0: break;
+        default: return nullptr;
+        }
+
+        if (!ok || (int)nvoices < 1 || nvoices > blepbank_max_count)
+            return nullptr;
+
+        x->x_shape = shape;
+        x->x_nvoices = nvoices;
+
+        uint nlanes = (nvoices + blepbank_lanes - 1) / blepbank_lanes * blepbank_lanes;
+        for (pd_dynarray<t_float> *v : {&x->x_p, &x->x_w, &x->x_b, &x->x_x,
+                                        &x->x_z, &x->x_dw, &x->x_db, &x->x_dph}) {
+            v->reset(nlanes);
+            v->fill(0);
+        }
+        x->x_k.reset(nlanes);
+        x->x_k.fill(0);
+        x->x_edge.reset(nlanes);
+        x->x_edge.fill(0);
+        x->x_f.reset((FILLEN + STEP_DD_PULSE_LENGTH) * nlanes);
+        x->x_f.fill(0);
+        // at most two discontinuities per voice and sample
+        x->x_events.reset(2 * nvoices);
+
+        x->x_inl_freq.reset(nvoices - 1);
+        for (uint i = 0; i < nvoices - 1; ++i)
+            x->x_inl_freq[i].reset(inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal));
+        x->x_otl_outp.reset(nvoices);
+        for (uint i = 0; i < nvoices; ++i)
+            x->x_otl_outp[i].reset(outlet_new(&x->x_obj, &s_signal));
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        x.reset();
+    }
+
+    return x.release();
+}
+
+// set the ramps of the increments and duty cycles of all the voices, toward
+// the frequencies at the start of a segment of m samples
+static void blepbank_ramp(
+    t_blepbank *xx, const uint i, const uint m,
+    const t_sample *const *freqin)
+{
+    const t_float fs = sys_getsr();
+
+    const uint nvoices = xx->x_nvoices;
+    const t_float *pw = xx->x_w.data();
+    const t_float *b = xx->x_b.data();
+    t_float *dw = xx->x_dw.data();
+    t_float *db = xx->x_db.data();
+    const t_float wave = xx->x_wave;
+
+    for (uint v = 0; v < nvoices; ++v) {
+        t_float t = jsl::clamp(freqin[v][i] / fs, 1e-5_f, 0.5_f);
+        dw[v] = (t - pw[v]) / m;
+        t = jsl::clamp(0.5_f * (1 + wave), pw[v], 1 - pw[v]);
+        db[v] = (t - b[v]) / m;
+    }
+}
+
+// process a group of voices over a segment, the voices in lockstep
+template <e_blepbank_shape Shape>
+static void blepbank_process_group(
+    t_blepbank *xx, const uint g0, const uint i0, const uint m,
+    t_sample *const *output)
+{
+    enum { L = blepbank_lanes };
+
+    const uint gv = std::min(xx->x_nvoices - g0, (uint)L);  /* active voices */
+    t_float *p = &xx->x_p[g0];  /* phase [0, 1) */
+    t_float *pw = &xx->x_w[g0];  /* phase increment */
+    t_float *b = &xx->x_b[g0];  /* duty cycle (0, 1) */
+    t_float *x = &xx->x_x[g0];  /* temporary output variable */
+    t_float *z = &xx->x_z[g0];  /* low pass filter state */
+    const t_float *dw = &xx->x_dw[g0];
+    const t_float *db = &xx->x_db[g0];
+    int *k = &xx->x_k[g0];  /* output state, 0 = high (0.5), 1 = low (-0.5) */
+    int *edge = &xx->x_edge[g0];
+    t_float *dph = &xx->x_dph[g0];  /* phase of falling edge */
+    t_float *f = &xx->x_f[g0 * (FILLEN + STEP_DD_PULSE_LENGTH)];
+    step_dd_event *events = xx->x_events.data();
+    int j = xx->x_j;  /* index into buffers f */
+    const t_float lpfilt = xx->x_lpfilt;
+
+    output += g0;
+
+    t_float a = 0.2_f + 0.8_f * lpfilt;
+
+    for (uint i = i0; i < i0 + m; ++i) {
+        /* advance the phases, and run the state machines of all the
+         * voices at once; the kinds of discontinuities are recorded for
+         * each voice as bits: falling, rising, falling after rising */
+        if (Shape == shape_rect) {
+#pragma omp simd
+            for (uint v = 0; v < L; ++v) {
+                pw[v] += dw[v];
+                b[v] += db[v];
+                t_float pv = p[v] + pw[v];
+                t_float bv = b[v];
+                int kv = k[v];
+                int wrap = pv >= 1;
+                t_float pn = pv - (t_float)wrap;
+                int fall = (kv ^ 1) & (pv >= bv);
+                int refall = kv & wrap & (pn >= bv);
+                t_float pd = fall ? pv : pn;
+                dph[v] = pd - bv;
+                kv = wrap ? refall : (kv | fall);
+                x[v] = kv ? -0.5_f : 0.5_f;
+                k[v] = kv;
+                p[v] = pn;
+                edge[v] = fall | (wrap << 1) | (refall << 2);
+            }
+        }
+        else {
+#pragma omp simd
+            for (uint v = 0; v < L; ++v) {
+                pw[v] += dw[v];
+                t_float pv = p[v] + pw[v];
+                int wrap = pv >= 1;
+                p[v] = pv - (t_float)wrap;
+                x[v] = 0.5_f - p[v];
+                edge[v] = wrap << 1;
+            }
+        }
+
+        /* place the discontinuities all at once, in the order which
+         * the scalar oscillators would */
+        uint edgemask = 0;
+        for (uint v = 0; v < L; ++v)
+            edgemask |= (uint)(edge[v] != 0) << v;
+        if (edgemask) {
+            uint nev = 0;
+            for (; edgemask; edgemask &= edgemask - 1) {
+                uint v = __builtin_ctz(edgemask);
+                int e = edge[v];
+                if (e & 1)
+                    events[nev++] = step_dd_event{v, dph[v], pw[v], -1.0_f};
+                if (e & 2)
+                    events[nev++] = step_dd_event{v, p[v], pw[v], 1.0_f};
+                if (e & 4)
+                    events[nev++] = step_dd_event{v, dph[v], pw[v], -1.0_f};
+            }
+            place_step_dd_batch(f, L, j, events, nev);
+        }
+
+        /* output a row */
+        t_float *fj = &f[j * L];
+        t_float *fd = &f[(j + DD_SAMPLE_DELAY) * L];
+#pragma omp simd
+        for (uint v = 0; v < L; ++v) {
+            fd[v] += x[v];
+            z[v] += a * (fj[v] - z[v]);
+        }
+        for (uint v = 0; v < gv; ++v)
+            output[v][i] = z[v];
+
+        if (++j == FILLEN) {
+            j = 0;
+            std::memcpy(f, f + FILLEN * L, STEP_DD_PULSE_LENGTH * L * sizeof(t_float));
+            std::memset(f + STEP_DD_PULSE_LENGTH * L, 0, FILLEN * L * sizeof(t_float));
+        }
+    }
+}
+
+static t_int *blepbank_perform(t_int *w)
+{
+    ++w;
+    t_blepbank *xx = (t_blepbank *)*w++;
+    const uint n = *w++;
+    const t_sample *const *freqin = (const t_sample *const *)w;
+    t_sample *const *output = (t_sample *const *)(w + xx->x_nvoices);
+
+    const t_float fs = sys_getsr();
+
+    const e_blepbank_shape shape = xx->x_shape;
+    const uint nvoices = xx->x_nvoices;
+    const uint nlanes = xx->x_p.size();
+
+    if (!xx->x_init) {
+        t_float *p = xx->x_p.data();
+        t_float *pw = xx->x_w.data();
+        t_float *b = xx->x_b.data();
+        t_float *x = xx->x_x.data();
+        int *k = xx->x_k.data();
+        const t_float wave = xx->x_wave;
+        for (uint v = 0; v < nvoices; ++v) {
+            t_float wv = jsl::clamp(freqin[v][0] / fs, 1e-5_f, 0.5_f);
+            pw[v] = wv;
+            p[v] = (shape == shape_saw) ? 0.5_f : 0;
+            b[v] = jsl::clamp(0.5_f * (1 + wave), wv, 1 - wv);
+            x[v] = 0.5;
+            k[v] = 0;
+        }
+        /* padding voices, which never produce a discontinuity */
+        for (uint v = nvoices; v < nlanes; ++v) {
+            pw[v] = 0;
+            p[v] = 0;
+            b[v] = 1;
+            x[v] = 0;
+            k[v] = 1;
+        }
+        xx->x_init = true;
+    }
+
+    /* the ramps are set for all the voices before any output is written
+       in the segment, because an output may share its buffer with the
+       input of another voice */
+    for (uint i0 = 0; i0 < n; i0 += 16) {
+        const uint m = std::min(n - i0, 16u);
+        blepbank_ramp(xx, i0, m, freqin);
+        for (uint g0 = 0; g0 < nvoices; g0 += blepbank_lanes) {
+            switch (shape) {
+            case shape_rect:
+                blepbank_process_group<shape_rect>(xx, g0, i0, m, output);
+                break;
+            case shape_saw:
+                blepbank_process_group<shape_saw>(xx, g0, i0, m, output);
+                break;
+            }
+        }
+        xx->x_j = (xx->x_j + m) % FILLEN;
+    }
+
+    return w + 2 * nvoices;
+}
+
+static void blepbank_dsp(t_blepbank *x, t_signal **sp)
+{
+    uint nvoices = x->x_nvoices;
+
+    t_int elts[2 + 2 * blepbank_max_count];
+    uint index = 0;
+
+    elts[index++] = (t_int)x;
+    elts[index++] = sp[0]->s_n;
+    for (uint i = 0; i < 2 * nvoices; ++i)
+        elts[index++] = (t_int)sp[i]->s_vec;
+
+    dsp_addv(blepbank_perform, index, elts);
+}
+
+static void blepbank_wave(t_blepbank *x, t_float f)
+{
+    x->x_wave = f;
+}
+
+static void blepbank_lowpass(t_blepbank *x, t_float f)
+{
+    x->x_lpfilt = f;
+}
+
+PDEX_API
+void blepbank_tilde_setup()
+{
+    t_class *cls = pd_make_class<t_blepbank>(
+        gensym("blepbank~"), (t_newmethod)&blepbank_new,
+        CLASS_DEFAULT, A_GIMME, A_NULL);
+    CLASS_MAINSIGNALIN(
+        cls, t_blepbank, x_signalin);
+    class_addmethod(
+        cls, (t_method)&blepbank_dsp, gensym("dsp"), A_CANT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&blepbank_wave, gensym("wave"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&blepbank_lowpass, gensym("lowpass"), A_FLOAT, A_NULL);
+}
@@ -23,7 +23,8 @@
 #include "blepvco/minblep_tables.h"
 #include <cmath>
 
-void place_step_dd(t_float *buffer, int index, t_float phase, t_float w, t_float scale)
+/* split the position of a discontinuity into table phase and fraction */
+static inline int dd_phase(t_float phase, t_float w, t_float *frac)
 {
     t_float r = MINBLEP_PHASES * phase / w;
     int i = std::lrint(r - 0.5_f);
@@ -35,26 +36,70 @@ void place_step_dd(t_float *buffer, int index, t_float phase, t_float w, t_float
      *    index++;
      *  }
      */
+    *frac = r;
+    return i;
+}
 
-    while (i < MINBLEP_PHASES * STEP_DD_PULSE_LENGTH) {
-        buffer[index] += scale * ((t_float)step_dd_table[i].value + r * (t_float)step_dd_table[i].delta);
-        i += MINBLEP_PHASES;
-        index++;
+void place_step_dd(t_float *buffer, int index, t_float phase, t_float w, t_float scale)
+{
+    t_float r;
+    const f32_step_dd_row &row = step_dd_table[dd_phase(phase, w, &r)];
+    t_float *dst = &buffer[index];
+
+#pragma omp simd
+    for (uint t = 0; t < STEP_DD_PULSE_LENGTH; ++t)
+        dst[t] += scale * ((t_float)row.value[t] + r * (t_float)row.delta[t]);
+}
+
+void place_step_dd_batch(t_float *buffer, uint stride, int index, const step_dd_event *events, uint count)
+{
+    for (uint e = 0; e < count; ++e) {
+        const step_dd_event &ev = events[e];
+        t_float r;
+        const f32_step_dd_row &row = step_dd_table[dd_phase(ev.phase, ev.w, &r)];
+        t_float *dst = &buffer[index * stride + ev.column];
+        const t_float scale = ev.scale;
+
+#pragma omp simd
+        for (uint t = 0; t < STEP_DD_PULSE_LENGTH; ++t)
+            dst[t * stride] += scale * ((t_float)row.value[t] + r * (t_float)row.delta[t]);
     }
 }
 
 void place_slope_dd(t_float *buffer, int index, t_float phase, t_float w, t_float slope_delta)
 {
-    t_float r = MINBLEP_PHASES * phase / w;
-    int i = std::lrint(r - 0.5_f);
-    r -= (t_float)i;
-    i &= MINBLEP_PHASE_MASK;  /* extreme modulation can cause i to be out-of-range */
+    t_float r;
+    const f32_slope_dd_row &row = slope_dd_table[dd_phase(phase, w, &r)];
+    t_float *dst = &buffer[index];
+
+    slope_delta *= w;
+
+#pragma omp simd
+    for (uint t = 0; t < SLOPE_DD_PULSE_LENGTH; ++t)
+        dst[t] += slope_delta * ((t_float)row.value[t] + r * (t_float)row.delta[t]);
+}
+
+//------------------------------------------------------------------------------
+void place_step_dd_ref(t_float *buffer, int index, t_float phase, t_float w, t_float scale)
+{
+    t_float r;
+    const f32_step_dd_row &row = step_dd_table[dd_phase(phase, w, &r)];
+
+    for (uint t = 0; t < STEP_DD_PULSE_LENGTH; ++t) {
+        buffer[index] += scale * ((t_float)row.value[t] + r * (t_float)row.delta[t]);
+        index++;
+    }
+}
+
+void place_slope_dd_ref(t_float *buffer, int index, t_float phase, t_float w, t_float slope_delta)
+{
+    t_float r;
+    const f32_slope_dd_row &row = slope_dd_table[dd_phase(phase, w, &r)];
 
     slope_delta *= w;
 
-    while (i < MINBLEP_PHASES * SLOPE_DD_PULSE_LENGTH) {
-        buffer[index] += slope_delta * ((t_float)slope_dd_table[i] + r * (t_float)(slope_dd_table[i + 1] - slope_dd_table[i]));
-        i += MINBLEP_PHASES;
+    for (uint t = 0; t < SLOPE_DD_PULSE_LENGTH; ++t) {
+        buffer[index] += slope_delta * ((t_float)row.value[t] + r * (t_float)row.delta[t]);
         index++;
     }
 }
@@ -27,3 +27,13 @@ enum { FILLEN = 256 };
 
 void place_step_dd(t_float *buffer, int index, t_float phase, t_float w, t_float scale);
 void place_slope_dd(t_float *buffer, int index, t_float phase, t_float w, t_float slope_delta);
+
+/* reference versions of the above, one tap at a time, whose results the
+ * vectorized versions must reproduce exactly */
+void place_step_dd_ref(t_float *buffer, int index, t_float phase, t_float w, t_float scale);
+void place_slope_dd_ref(t_float *buffer, int index, t_float phase, t_float w, t_float slope_delta);
+
+/* discontinuities of several oscillators, whose buffers are interleaved in rows
+ * of the given stride, the column identifying the oscillator */
+struct step_dd_event { uint column; t_float phase, w, scale; };
+void place_step_dd_batch(t_float *buffer, uint stride, int index, const step_dd_event *events, uint count);
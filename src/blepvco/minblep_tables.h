@@ -38,8 +38,10 @@ enum {
     DD_SAMPLE_DELAY          = 4,
 };
 
-typedef struct { f32 value, delta; } f32_value_delta;
+/* pulse at a given phase, with differences to the next phase: */
+typedef struct { f32 value[STEP_DD_PULSE_LENGTH], delta[STEP_DD_PULSE_LENGTH]; } f32_step_dd_row;
+typedef struct { f32 value[SLOPE_DD_PULSE_LENGTH], delta[SLOPE_DD_PULSE_LENGTH]; } f32_slope_dd_row;
 
 /* in minblep_tables.c: */
-extern const f32_value_delta step_dd_table[];
-extern const f32             slope_dd_table[];
+extern const f32_step_dd_row  step_dd_table[MINBLEP_PHASES];
+extern const f32_slope_dd_row slope_dd_table[MINBLEP_PHASES];
@@ -0,0 +1,298 @@
+/*
+ * Loading of instrument banks from files
+ */
+
+#include "OPLBank.h"
+#include "OPLSynth.h"
+#include "util/mapped_file.h"
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string.h>
+#include <sys/stat.h>
+
+namespace {
+
+// Reading in the mapped file
+struct BankReader
+{
+   const BYTE *pData;
+   size_t  uSize;
+
+   const BYTE *At(size_t uOffset, size_t uLen) const
+   {
+      if (uOffset > uSize || uSize - uOffset < uLen)
+         throw std::runtime_error("truncated bank file");
+      return pData + uOffset;
+   }
+   WORD BE16(size_t uOffset) const
+      { const BYTE *p = At(uOffset, 2); return (p[0] << 8) | p[1]; }
+   WORD LE16(size_t uOffset) const
+      { const BYTE *p = At(uOffset, 2); return p[0] | (p[1] << 8); }
+};
+
+// Fine tune, from fractions of semitone to the units of the mappings
+short FineTune(int iFine, int iSteps)
+{
+   return (short)(iFine * 200 / iSteps);
+}
+
+// Percussion key to play, moved by the offset of the note
+BYTE DrumNote(int iNote, int iOffset)
+{
+   iNote += iOffset;
+   return (BYTE)((iNote < 0) ? 0 : (iNote > 127) ? 127 : iNote);
+}
+
+//------------------------------------------------------------------------
+// WOPL: OPL3 bank of libADLMIDI, the first melodic and drum banks
+//------------------------------------------------------------------------
+enum {
+   WOPL_HEADER_SIZE    = 19,
+   WOPL_BANKMETA_SIZE  = 34,
+   WOPL_INST_SIZE_V2   = 62,
+   WOPL_INST_SIZE_V3   = 66,
+   WOPL_FLAG_4OP       = 0x01,
+   WOPL_FLAG_PSEUDO4OP = 0x02,
+   WOPL_FLAG_BLANK     = 0x04,
+};
+
+void WOPL_ReadPatch(const BYTE *pIns, Patch &patch)
+{
+   static const BYTE bRhythm[8] =
+      { 0, RHY_CH_BD, RHY_CH_SD, RHY_CH_TOM, RHY_CH_CY, RHY_CH_HH, 0, 0 };
+   BYTE bFlags = pIns[39];
+
+   patch = Patch{};
+   if (bFlags & WOPL_FLAG_BLANK)
+      return;
+
+   // Operators of the file are the carrier then the modulator of each pair
+   static const BYTE bOpOrder[NUMOPS] = { 1, 0, 3, 2 };
+   for (unsigned i = 0; i < NUMOPS; ++i)
+   {
+      const BYTE *pOp = pIns + 42 + 5 * bOpOrder[i];
+      patch.op[i].bAt20 = pOp[0];
+      patch.op[i].bAt40 = pOp[1];
+      patch.op[i].bAt60 = pOp[2];
+      patch.op[i].bAt80 = pOp[3];
+      patch.op[i].bAtE0 = pOp[4];
+   }
+   patch.bAtC0[0] = pIns[40] | 0x30;
+   patch.bAtC0[1] = pIns[41] | 0x30;
+   patch.bOp =
+      (bFlags & WOPL_FLAG_4OP) ? PATCH_1_4OP :
+      (bFlags & WOPL_FLAG_PSEUDO4OP) ? PATCH_2_2OP : PATCH_1_2OP;
+   patch.bRhythmMap = bRhythm[(bFlags >> 3) & 7];
+}
+
+void WOPL_Load(const BankReader &rd, OPLBank &bank)
+{
+   WORD wVersion = rd.LE16(11);
+   WORD wMelBanks = rd.BE16(13);
+   WORD wPercBanks = rd.BE16(15);
+   if (wVersion < 1 || wVersion > 3)
+      throw std::runtime_error("unsupported version of WOPL");
+
+   size_t uOffset = WOPL_HEADER_SIZE;
+   if (wVersion >= 2)
+      uOffset += (wMelBanks + wPercBanks) * WOPL_BANKMETA_SIZE;
+   const size_t uInsSize = (wVersion >= 3) ? WOPL_INST_SIZE_V3 : WOPL_INST_SIZE_V2;
+
+   if (wMelBanks > 0)
+   {
+      for (unsigned i = 0; i < 128; ++i)
+      {
+         const BYTE *pIns = rd.At(uOffset + i * uInsSize, uInsSize);
+         WOPL_ReadPatch(pIns, bank.patch[i]);
+         MelMap &map = bank.melMap[i];
+         map = MelMap{};
+         map.bPreset = i;
+         map.wBaseTranspose = (short)rd.BE16(uOffset + i * uInsSize + 32);
+         map.wSecondTranspose = (short)rd.BE16(uOffset + i * uInsSize + 34);
+         // The detune of the second voice, as libADLMIDI reads it
+         map.wSecondFineTune = FineTune((((int)(signed char)pIns[37] + 128) >> 1) - 64, 32);
+      }
+   }
+
+   if (wPercBanks > 0)
+   {
+      uOffset += wMelBanks * 128 * uInsSize;
+      for (unsigned i = 0; i < 128; ++i)
+      {
+         const BYTE *pIns = rd.At(uOffset + i * uInsSize, uInsSize);
+         WOPL_ReadPatch(pIns, bank.patch[128 + i]);
+         PercMap &map = bank.percMap[i];
+         map = PercMap{};
+         map.bPreset = i;
+         map.bBaseNote = DrumNote(
+            pIns[38] ? pIns[38] : i, (short)rd.BE16(uOffset + i * uInsSize + 32));
+      }
+   }
+}
+
+//------------------------------------------------------------------------
+// OP2: DMX bank of Doom, 128 melodic then 47 drums of keys 35 to 81
+//------------------------------------------------------------------------
+enum {
+   OP2_HEADER_SIZE     = 8,
+   OP2_INST_SIZE       = 36,
+   OP2_NUM_INST        = 175,
+   OP2_FLAG_FIXED      = 0x01,
+   OP2_FLAG_DOUBLE     = 0x04,
+};
+
+void OP2_ReadVoice(const BYTE *pVoice, Operator &mod, Operator &car, BYTE &bC0)
+{
+   mod.bAt20 = pVoice[0];
+   mod.bAt60 = pVoice[1];
+   mod.bAt80 = pVoice[2];
+   mod.bAtE0 = pVoice[3];
+   mod.bAt40 = pVoice[4] | pVoice[5];
+   bC0 = pVoice[6] | 0x30;
+   car.bAt20 = pVoice[7];
+   car.bAt60 = pVoice[8];
+   car.bAt80 = pVoice[9];
+   car.bAtE0 = pVoice[10];
+   car.bAt40 = pVoice[11] | pVoice[12];
+}
+
+void OP2_Load(const BankReader &rd, OPLBank &bank)
+{
+   for (unsigned i = 0; i < OP2_NUM_INST; ++i)
+   {
+      size_t uOffset = OP2_HEADER_SIZE + i * OP2_INST_SIZE;
+      const BYTE *pIns = rd.At(uOffset, OP2_INST_SIZE);
+      WORD wFlags = rd.LE16(uOffset);
+      BYTE bFineTune = pIns[2];
+      BYTE bFixedNote = pIns[3];
+      short wOffset1 = (short)rd.LE16(uOffset + 4 + 14);
+      short wOffset2 = (short)rd.LE16(uOffset + 4 + 16 + 14);
+
+      Patch patch{};
+      OP2_ReadVoice(pIns + 4, patch.op[0], patch.op[1], patch.bAtC0[0]);
+      OP2_ReadVoice(pIns + 4 + 16, patch.op[2], patch.op[3], patch.bAtC0[1]);
+      patch.bOp = (wFlags & OP2_FLAG_DOUBLE) ? PATCH_2_2OP : PATCH_1_2OP;
+
+      if (i < 128)
+      {
+         bank.patch[i] = patch;
+         MelMap &map = bank.melMap[i];
+         map = MelMap{};
+         map.bPreset = i;
+         map.wBaseTranspose = wOffset1;
+         map.wSecondTranspose = wOffset2;
+         map.wSecondFineTune = FineTune((int)bFineTune - 128, 64);
+      }
+      else
+      {
+         unsigned uKey = i - 128 + 35;
+         bank.patch[128 + uKey] = patch;
+         PercMap &map = bank.percMap[uKey];
+         map = PercMap{};
+         map.bPreset = uKey;
+         map.bBaseNote = DrumNote(
+            (wFlags & OP2_FLAG_FIXED) ? bFixedNote : uKey, wOffset1);
+      }
+   }
+}
+
+//------------------------------------------------------------------------
+// IBK: bank of Creative SBI, 128 melodic 2-op instruments
+//------------------------------------------------------------------------
+enum {
+   IBK_HEADER_SIZE     = 4,
+   IBK_INST_SIZE       = 16,
+};
+
+void IBK_Load(const BankReader &rd, OPLBank &bank)
+{
+   for (unsigned i = 0; i < 128; ++i)
+   {
+      const BYTE *pIns = rd.At(IBK_HEADER_SIZE + i * IBK_INST_SIZE, IBK_INST_SIZE);
+
+      // Modulator and carrier are interleaved by register
+      Patch &patch = bank.patch[i];
+      patch = Patch{};
+      for (unsigned j = 0; j < 2; ++j)
+      {
+         patch.op[j].bAt20 = pIns[0 + j];
+         patch.op[j].bAt40 = pIns[2 + j];
+         patch.op[j].bAt60 = pIns[4 + j];
+         patch.op[j].bAt80 = pIns[6 + j];
+         patch.op[j].bAtE0 = pIns[8 + j];
+      }
+      patch.bAtC0[0] = pIns[10] | 0x30;
+      patch.bOp = PATCH_1_2OP;
+
+      MelMap &map = bank.melMap[i];
+      map = MelMap{};
+      map.bPreset = i;
+      map.wBaseTranspose = (signed char)pIns[12];
+   }
+}
+
+//------------------------------------------------------------------------
+std::shared_ptr<OPLBank> LoadFile(const char *path)
+{
+   mapped_file file;
+   file.open(path);
+
+   BankReader rd{file.data(), file.size()};
+   const BYTE *pMagic = rd.At(0, 4);
+
+   // Drums which the file does not define keep the default ones
+   std::shared_ptr<OPLBank> bank(new OPLBank(gDefaultBank));
+
+   if (file.size() >= WOPL_HEADER_SIZE && !memcmp(rd.At(0, 11), "WOPL3-BANK", 11))
+      WOPL_Load(rd, *bank);
+   else if (file.size() >= OP2_HEADER_SIZE && !memcmp(rd.At(0, 8), "#OPL_II#", 8))
+      OP2_Load(rd, *bank);
+   else if (!memcmp(pMagic, "IBK\x1a", 4))
+      IBK_Load(rd, *bank);
+   else
+      throw std::runtime_error("unknown format of bank");
+
+   return bank;
+}
+
+// Banks in use, by path, with the modification time of the file
+struct CacheEntry
+{
+   std::weak_ptr<const OPLBank> bank;
+   time_t  tMtime;
+};
+
+std::mutex gCacheMutex;
+std::map<std::string, CacheEntry> gCache;
+
+} // namespace
+
+std::shared_ptr<const OPLBank> OPLBank_Load(const char *path)
+{
+   struct stat st;
+   if (stat(path, &st) != 0)
+      throw std::runtime_error("cannot open bank file");
+
+   std::lock_guard<std::mutex> lock(gCacheMutex);
+
+   // Drop the banks which nobody uses anymore
+   for (auto it = gCache.begin(); it != gCache.end();)
+   {
+      if (it->second.bank.expired())
+         it = gCache.erase(it);
+      else
+         ++it;
+   }
+
+   CacheEntry &entry = gCache[path];
+   std::shared_ptr<const OPLBank> bank = entry.bank.lock();
+   if (!bank || entry.tMtime != st.st_mtime)
+   {
+      bank = LoadFile(path);
+      entry.bank = bank;
+      entry.tMtime = st.st_mtime;
+   }
+   return bank;
+}
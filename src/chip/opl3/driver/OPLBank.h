@@ -0,0 +1,12 @@
+/*
+ * Loading of instrument banks from files
+ */
+
+#pragma once
+#include "OPLPatch.h"
+#include <memory>
+
+// Load a bank in format WOPL, OP2 or IBK. A file in use by an instance is
+// loaded once and shared, until it is modified. Throw std::runtime_error
+// in case of failure.
+std::shared_ptr<const OPLBank> OPLBank_Load(const char *path);
@@ -437,3 +437,10 @@ const std::array<Patch, 256> glpDefaultPatch
    { {{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}},{0x00,0x00},{0x00,0x00},{0x00,0x00},0x00,0x00 },
    { {{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}},{0x00,0x00},{0x00,0x00},{0x00,0x00},0x00,0x00 }
 }};
+
+const OPLBank gDefaultBank =
+{
+   glpDefaultPatch,
+   gbDefaultMelMap,
+   gbDefaultPercMap,
+};
@@ -59,6 +59,15 @@ struct PercMap
    BYTE bPitchEGAmt;
 };
 
+/* instruments and their mappings, 128 melodic patches then 128 drums */
+struct OPLBank
+{
+   std::array<Patch, 256> patch;
+   std::array<MelMap, 128> melMap;
+   std::array<PercMap, 128> percMap;
+};
+
 extern const std::array<MelMap, 128> gbDefaultMelMap;
 extern const std::array<PercMap, 128> gbDefaultPercMap;
 extern const std::array<Patch, 256> glpDefaultPatch;
+extern const OPLBank gDefaultBank;
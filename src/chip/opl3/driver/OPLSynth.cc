@@ -15,6 +15,37 @@
 #include <string.h>
 #include <math.h>
 
+// Tables of the pitch engine
+namespace {
+struct PitchTables
+{
+   enum {
+      FNUM_STEPS = 64,                 /* per semitone */
+      FNUM_SIZE  = 12 * FNUM_STEPS,    /* one octave */
+      SINE_SIZE  = 1024,               /* one cycle */
+   };
+
+   // F-number at block 0 of the lowest octave, scaled by 2^16
+   Bit32u fnum[FNUM_SIZE + 1];
+   // sine in Q15
+   Bit16s sine[SINE_SIZE + 1];
+
+   PitchTables()
+   {
+      for (unsigned i = 0; i <= FNUM_SIZE; ++i)
+      {
+         double note = (double)i / FNUM_STEPS;
+         double freq = 440.0 * pow(2.0, (note - 69) / 12.0);
+         fnum[i] = (Bit32u)(freq * (1 << 20) / FSAMP * 65536 + 0.5);
+      }
+      for (unsigned i = 0; i <= SINE_SIZE; ++i)
+         sine[i] = (Bit16s)floor(0.5 + 32767 * sin(2 * M_PI * i / SINE_SIZE));
+   }
+};
+
+const PitchTables gPitchTables;
+}  // namespace
+
 void
    OPLSynth::
    WriteMidiData(DWORD dwData)
@@ -38,7 +69,7 @@ void
             //if(bNote>=35 && bNote<88)
             {
                //Opl3_NoteOn((BYTE)(gbPercMap[bNote - 35].bPreset+35+128),gbPercMap[bNote - 35].bBaseNote,bChannel,bVelocity,m_iBend[bChannel]);
-               Opl3_NoteOn((BYTE)(gbPercMap[bNote].bPreset+128),gbPercMap[bNote].bBaseNote,bChannel,bVelocity,m_iBend[bChannel]);
+               Opl3_NoteOn((BYTE)(m_pBank->percMap[bNote].bPreset+128),m_pBank->percMap[bNote].bBaseNote,bChannel,bVelocity,m_iBend[bChannel]);
             }
          }
          else
@@ -58,7 +89,7 @@ void
          //if(bNote>=35 && bNote<88)
          {
             //Opl3_NoteOff((BYTE)(gbPercMap[bNote - 35].bPreset+35+128),gbPercMap[bNote - 35].bBaseNote, bChannel, 0);
-            Opl3_NoteOff((BYTE)(gbPercMap[bNote].bPreset+128),gbPercMap[bNote].bBaseNote, bChannel, 0);
+            Opl3_NoteOff((BYTE)(m_pBank->percMap[bNote].bPreset+128),m_pBank->percMap[bNote].bBaseNote, bChannel, 0);
          }
       }
       else
@@ -169,10 +200,10 @@ void
                for (int j = 0; j < 2; ++j)
                {
                   WORD wOffset = gw2OpOffset[ i ][ j ] ;
-                  BYTE bInst = glpPatch[m_Voice[i].bPatch].op[j].bAt80;
+                  BYTE bInst = m_pBank->patch[m_Voice[i].bPatch].op[j].bAt80;
                   char bTemp = bInst & 0xF;
 
-                  if (glpPatch[m_Voice[i].bPatch].bAtC0[0] & 0x01)
+                  if (m_pBank->patch[m_Voice[i].bPatch].bAtC0[0] & 0x01)
                      continue;
 
                   bInst &= ~0xF;
@@ -193,7 +224,7 @@ void
             {
                char bOffset = (char)lin_intp(m_bAttack[bChannel], 0, 127, (-16), 16);
                WORD wOffset;
-               BYTE bInst = glpPatch[m_Voice[i].bPatch].op[1].bAt60;
+               BYTE bInst = m_pBank->patch[m_Voice[i].bPatch].op[1].bAt60;
                char bTemp = ((bInst & 0xF0)>>4);
 
                if (!bOffset)
@@ -205,7 +236,7 @@ void
                      continue;
 
                   wOffset = gw2OpOffset[ i ][ j ] ;
-                  bInst = glpPatch[m_Voice[i].bPatch].op[j].bAt60;
+                  bInst = m_pBank->patch[m_Voice[i].bPatch].op[j].bAt60;
                   bTemp = ((bInst & 0xF0)>>4);
 
                   bInst &= ~0xF0;
@@ -226,7 +257,7 @@ void
             if (m_Voice[i].bChannel == bChannel)
             {
                WORD wOffset = gw2OpOffset[ i ][ 0 ] ;
-               BYTE bInst = glpPatch[m_Voice[i].bPatch].op[0].bAt40;
+               BYTE bInst = m_pBank->patch[m_Voice[i].bPatch].op[0].bAt40;
                char bTemp = bInst & 0x3F;
                char bOffset = (char)lin_intp(m_bBrightness[bChannel], 0, 127, (-32), 32);
                bInst &= ~0x3F;
@@ -356,7 +387,7 @@ void
    OPLSynth::
    Opl3_NoteOff(BYTE bPatch, BYTE bNote, BYTE bChannel, BYTE bSustain)
 {
-   Patch        *lpPS = &glpPatch[bPatch] ;
+   const Patch  *lpPS = &m_pBank->patch[bPatch] ;
    WORD         wTemp, wTemp2 ;
    BYTE         b4Op = (BYTE)(lpPS->bOp != PATCH_1_2OP);
 
@@ -705,7 +736,8 @@ void
 {
    WORD             wTemp, i, j, wTemp2 = ~0 ;
    BYTE             b4Op, /*bTemp, */bMode, bStereo, bRhyPatch;
-   Patch            *lpPS, NS ;
+   const Patch      *lpPS ;
+   Patch            NS ;
    short            wBaseFineTune     = 0,
                     wBaseCoarseTune   = 0,
                     wSecondFineTune   = 0,
@@ -714,18 +746,17 @@ void
    //DWORD            dwBasicPitch, dwPitch[ 2 ] ;
 
    // Increment voice allocation ID (needed for pairing operator pairs for 2x2op patches)
-   static BYTE      bVoiceID = 0;
 
    if (bPatch < 128)
    {
-      wBaseFineTune     = gbMelMap[bPatch].wBaseFineTune,
-      wBaseCoarseTune   = gbMelMap[bPatch].wBaseTranspose,
-      wSecondFineTune   = gbMelMap[bPatch].wSecondFineTune,
-      wSecondCoarseTune = gbMelMap[bPatch].wSecondTranspose;
+      wBaseFineTune     = m_pBank->melMap[bPatch].wBaseFineTune,
+      wBaseCoarseTune   = m_pBank->melMap[bPatch].wBaseTranspose,
+      wSecondFineTune   = m_pBank->melMap[bPatch].wSecondFineTune,
+      wSecondCoarseTune = m_pBank->melMap[bPatch].wSecondTranspose;
    }
 
    // Get a pointer to the patch
-   lpPS = &glpPatch[bPatch] ;
+   lpPS = &m_pBank->patch[bPatch] ;
    // Find out the basic pitch according to our
    // note value.  This may be adjusted because of
    // pitch bends or special qualities for the note.
@@ -889,6 +920,7 @@ void
 
    m_Voice[wTemp].dwPortaSampTime = (DWORD)floor(0.5 + pow(((double)m_bPortaTime[bChannel]*0.4), 1.5)); //m_bPortaTime[bChannel];
    m_Voice[wTemp].dwPortaSampCnt = m_Voice[wTemp].dwPortaSampTime; //m_bPortaTime[bChannel];
+   m_Voice[wTemp].wPortaFrac = 0;
    if ((bNote == m_bLastNoteUsed[bChannel] /*&& !m_Voice[bChannel].bOn && !m_Voice[bChannel].bSusHeld*/)
       || m_bLastNoteUsed[bChannel] == (BYTE)0xFF || (m_wPortaMode & (1<<bChannel)) == 0)
       m_Voice[wTemp].dwPortaSampCnt = 0;
@@ -969,6 +1001,7 @@ void
 
                m_Voice[wTemp2].dwPortaSampTime = (DWORD)floor(0.5 + pow(((double)m_bPortaTime[bChannel]*0.4), 1.5)); //m_bPortaTime[bChannel];
                m_Voice[wTemp2].dwPortaSampCnt = m_Voice[wTemp2].dwPortaSampTime; //m_bPortaTime[bChannel];
+               m_Voice[wTemp2].wPortaFrac = 0;
                if ((bNote == m_bLastNoteUsed[bChannel] /*&& !m_Voice[bChannel].bOn && !m_Voice[bChannel].bSusHeld*/)
                   || (m_wPortaMode & (1<<bChannel)) == 0 || m_bLastNoteUsed[bChannel] == (BYTE)0xFF)
                   m_Voice[wTemp2].dwPortaSampCnt = 0;
@@ -1041,12 +1074,12 @@ void
    Opl3_FMNote(wTemp, &NS, bChannel, wTemp2 ) ; // TODO refactor functionality to insert second operator
 
    m_bLastVoiceUsed[bChannel] = (BYTE)wTemp; // save voice ref
-   m_Voice[ wTemp ].bVoiceID = ++bVoiceID;
+   m_Voice[ wTemp ].bVoiceID = ++m_bVoiceID;
    m_bLastNoteUsed[bChannel] = bNote;
    if (b4Op)
    {
       if (wTemp2 != (WORD)~0)
-         m_Voice[ wTemp2 ].bVoiceID = bVoiceID;
+         m_Voice[ wTemp2 ].bVoiceID = m_bVoiceID;
    }
 
    // Add to note history as most recent note
@@ -1119,7 +1152,7 @@ bool
    OPLSynth::
    Opl3_IsPatchEmpty(BYTE bPatch)
 {
-   Patch *lpPS = &glpPatch[bPatch];
+   const Patch *lpPS = &m_pBank->patch[bPatch];
    DWORD isEmpty = 0;
 
    for (BYTE i = 0; i < NUMOPS; ++i)
@@ -1447,7 +1480,7 @@ void
    Opl3_SetVolume(BYTE bChannel)
 {
    WORD            i, j, wTemp, wOffset ;
-   Patch           *lpPS;
+   const Patch     *lpPS;
    Operator        opSt;
    BYTE            bMode, bStereo, bOffset ;
    char            bTemp;
@@ -1460,7 +1493,7 @@ void
       if ((m_Voice[ i ].bChannel == bChannel) || (bChannel == 0xff))
       {
          // Get a pointer to the patch
-         lpPS = &(glpPatch[ m_Voice[ i ].bPatch ]);
+         lpPS = &(m_pBank->patch[ m_Voice[ i ].bPatch ]);
 
          // Modify level for each operator, IF they are carrier waves...
          bMode = (BYTE) ( (lpPS->bAtC0[0] & 0x01) * 2 + 4);
@@ -1598,7 +1631,7 @@ void
 //     Special thanks to ValleyBell for MidiPlay sources for adaption
 //
 //  Parameters:
-//     double note   - MIDI note number (promoted from BYTE)
+//     BYTE note     - MIDI note number
 //     BYTE bChannel - channel
 //     long dwLFOVal - current magnitude of the modulation waveform
 //
@@ -1607,33 +1640,75 @@ void
 // ===========================================================================
 WORD
    OPLSynth::
-   Opl3_MIDINote2FNum(double note, BYTE bChannel, long dwLFOVal)
+   Opl3_MIDINote2FNum(BYTE note, BYTE bChannel, long dwLFOVal)
 {
-	double freqVal, curNote, RPNTune;
-	signed char BlockVal;
-	WORD keyVal;
-//	signed long CurPitch;
+   return Opl3_Pitch2FNum(note * PITCH_UNIT + Opl3_ChannelPitch(bChannel) + dwLFOVal);
+}
 
+// ===========================================================================
+//  long Opl3_ChannelPitch
+//
+//  Description:
+//     Offset of pitch of a channel, by tuning and bend, in 1/8192 semitones
+// ===========================================================================
+long
+   OPLSynth::
+   Opl3_ChannelPitch(BYTE bChannel) const
+{
    /*TODO: keep for later, may add other features */
 	//CurPitch = //MMstTuning + TempMid->TunePb + TempMid->Pitch + TempMid->ModPb;
 
-   RPNTune = ((signed)m_bCoarseTune[bChannel] - 64);
-   RPNTune += lin_intp(m_bFineTune[bChannel], 0, 127, (-1), 1);
+   // RPN coarse tuning in semitones, and fine tuning from -1 to +1
+   long RPNTune = ((signed)m_bCoarseTune[bChannel] - 64 - 1) * PITCH_UNIT +
+      (m_bFineTune[bChannel] * 2 * PITCH_UNIT + 63) / 127;
+
+   return m_bMasterCoarseTune * PITCH_UNIT + RPNTune +
+      m_iBend[bChannel] * m_iBendRange[bChannel];
+}
+
+// ===========================================================================
+//  WORD Opl3_Pitch2FNum
+//
+//  Description:
+//     Obtains FNumber from a pitch in 1/8192 semitones, by table
+//
+//  Return Value:
+//     ((WORD) BlockVal << 10) | (WORD) keyVal;
+// ===========================================================================
+WORD
+   OPLSynth::
+   Opl3_Pitch2FNum(long lPitch)
+{
+   enum { OCTAVE = 12 * PITCH_UNIT, STEP = PITCH_UNIT / PitchTables::FNUM_STEPS };
+
+   // octave and position within, rounded down
+   long octave = (lPitch >= 0) ? (lPitch / OCTAVE) : ((lPitch + 1) / OCTAVE - 1);
+   long pos = lPitch - octave * OCTAVE;
 
-	curNote = (double)(note + m_bMasterCoarseTune + RPNTune + (m_iBend[bChannel] * m_iBendRange[bChannel] + dwLFOVal) / 8192.0); //Note + CurPitch / 8192.0;
-	freqVal = 440.0 * pow(2.0, (curNote - 69) / 12.0);
 	//BlockVal = ((signed short int)CurNote / 12) - 1;
-	BlockVal = ((signed short int)(curNote + 6) / 12) - 2;
+   long BlockVal = octave + (pos >= 6 * PITCH_UNIT) - 2;
 	if (BlockVal < 0x00)
 		BlockVal = 0x00;
 	else if (BlockVal > 0x07)
 		BlockVal = 0x07;
-	//KeyVal = (unsigned short int)(FreqVal * pow(2, 20 - BlockVal) / CHIP_RATE + 0.5);
-	keyVal = (WORD)(freqVal * (1ULL << (20 - BlockVal)) / FSAMP + 0.5);
-	if (keyVal > 0x03FF)
-		keyVal = 0x03FF;
 
-	return (BlockVal << 10) | keyVal;	// << (8+2)
+   const Bit32u *fnum = &gPitchTables.fnum[pos / STEP];
+   Bit32u frac = pos % STEP;
+   Bit64u keyVal = fnum[0] + (((fnum[1] - fnum[0]) * frac) / STEP);
+
+   long shift = octave - BlockVal;
+   if (shift > 16)
+      keyVal = 0x03FF;
+   else
+   {
+      keyVal = (shift >= 0) ? (keyVal << shift) :
+         (shift > -32) ? (keyVal >> -shift) : 0;
+      keyVal = (keyVal + 0x8000) >> 16;
+      if (keyVal > 0x03FF)
+         keyVal = 0x03FF;
+   }
+
+	return (WORD)((BlockVal << 10) | keyVal);	// << (8+2)
 }
 
 
@@ -1734,7 +1809,7 @@ WORD
    if (foundOldestOff != 0xffff)
       return ( foundOldestOff ) ;
 
-   if (foundOldestCurCh != 0xffff && bChnVoiceCnt > (glpPatch[bPatch].bOp == PATCH_2_2OP ? 4 : 2))
+   if (foundOldestCurCh != 0xffff && bChnVoiceCnt > (m_pBank->patch[bPatch].bOp == PATCH_2_2OP ? 4 : 2))
       return ( foundOldestCurCh ) ;
 
    return foundOldestOn;
@@ -1999,7 +2074,7 @@ void
    Opl3_CutVoice(BYTE bVoice, BYTE bIsInstantCut)
 {
    WORD wOffset = bVoice, wOpOffset;
-   Patch *lpNS = &(glpPatch[ m_Voice[bVoice].bPatch]);
+   const Patch *lpNS = &(m_pBank->patch[ m_Voice[bVoice].bPatch]);
    BYTE bOp = lpNS->bOp;
 
    if (bVoice >= (NUM2VOICES / 2))
@@ -2075,6 +2150,7 @@ bool
 {
    // init some members
    this->m_dwCurTime = 1;    /* for note on/off */
+   this->m_dwCurSample = 0;
    /* volume */
    this->m_wSynthAttenL = 0;        /* in 1.5dB steps */
    this->m_wSynthAttenR = 0;        /* in 1.5dB steps */
@@ -2097,6 +2173,16 @@ bool
    }
 
    OPL3_Reset(&m_Miniport, rate);
+   memset(m_bChipReg, 0, sizeof(m_bChipReg));
+
+   this->m_EventQueue.reset(MIDI_QUEUE_SIZE);
+   this->m_SysexQueue.reset(SYSEX_QUEUE_SIZE);
+   this->m_pEditBank.reset(new OPLBank);
+
+   this->m_uRate = rate;
+   SetQuality(RSM_QUALITY_DEFAULT);
+   SetPitchPeriod(PITCH_PERIOD_DEFAULT);
+   std::fill(m_wPitchReg, m_wPitchReg + NUM2VOICES, (WORD)~0);
 
    Opl3_BoardReset();
    Opl3_SoftCommandReset();
@@ -2108,107 +2194,519 @@ void
    OPLSynth::
    Opl3_LFOUpdate(BYTE bVoice)
 {
+   Voice &voice = m_Voice[bVoice];
    WORD  wTemp, wOffset;
-   long  newLFOVal = m_Voice[bVoice].dwLFOVal,
-         newDetuneEG = m_Voice[bVoice].dwDetuneEG;
-   DWORD timeDiff = m_dwCurSample-m_Voice[bVoice].dwStartTime;
-   double timeLapse = 0.00025*3.14159265358979323846*(double)(timeDiff),
-          noteDiff = 0;
+   long  newLFOVal = voice.dwLFOVal,
+         newDetuneEG = voice.dwDetuneEG,
+         notePitch = voice.bNote * PITCH_UNIT;
+   DWORD timeDiff = m_dwCurSample-voice.dwStartTime;
+   bool  bPorta = false;
 
    // Portamento update first
-   if (m_Voice[bVoice].dwPortaSampCnt > 0)
+   if (voice.dwPortaSampCnt > 0)
    {
-      const double PORTA_DEC_RATE = 3.333;
+      // 3 steps every 64 samples
+      enum { PORTA_DEC_RATE = 3 };
 
-      //--m_Voice[bVoice].bPortaSampCnt;
-      m_Voice[bVoice].dwPortaSampCnt = ((m_Voice[bVoice].dwPortaSampCnt-PORTA_DEC_RATE) <= 0) ?
-         0 : (DWORD)floor(0.5 + m_Voice[bVoice].dwPortaSampCnt-PORTA_DEC_RATE);
+      DWORD dwFrac = voice.wPortaFrac + PORTA_DEC_RATE * m_uPitchPeriod;
+      DWORD dwSteps = dwFrac / 64;
+      if (dwSteps >= voice.dwPortaSampCnt)
+      {
+         voice.dwPortaSampCnt = 0;
+         voice.wPortaFrac = 0;
+      }
+      else
+      {
+         voice.dwPortaSampCnt -= dwSteps;
+         voice.wPortaFrac = dwFrac % 64;
+      }
 
-      noteDiff = (double)lin_intp(
-         (m_Voice[bVoice].dwPortaSampTime - m_Voice[bVoice].dwPortaSampCnt),
-         0,
-         m_Voice[bVoice].dwPortaSampTime,
-         m_Voice[bVoice].bPrevNote,
-         m_Voice[bVoice].bNote
-      );
+      // interpolate from the previous note, in 1/64 steps
+      Bit64s range = (Bit64s)voice.dwPortaSampTime * 64;
+      Bit64s remain = (Bit64s)voice.dwPortaSampCnt * 64 - voice.wPortaFrac;
+      if (range > 0 && remain > 0)
+         notePitch = voice.bPrevNote * PITCH_UNIT + (long)(
+            (Bit64s)(voice.bNote - voice.bPrevNote) * PITCH_UNIT * (range - remain) / range);
 
-      /*noteDiff = m_Voice[bVoice].dwNoteFactor*(m_Voice[bVoice].dwPortaSampTime
-         - m_Voice[bVoice].bPortaSampCnt) - 1;*/
+      bPorta = true;
    }
 
    // 100Hz sine wave with half semitone magnitude by default
    // (mod*32)sin((1/100)*FSAMP * curSample)
-   if (m_bModWheel[m_Voice[bVoice].bChannel] > 0)
-      newLFOVal = (long)floor(0.5 + (m_bModWheel[m_Voice[bVoice].bChannel]*32)*sin(timeLapse));
+   if (m_bModWheel[voice.bChannel] > 0)
+   {
+      // 8000 samples per cycle, in 1/128 steps of table
+      DWORD dwPhase = (timeDiff % 8000) * (PitchTables::SINE_SIZE * 128 / 8) / 1000;
+      const Bit16s *sine = &gPitchTables.sine[dwPhase / 128];
+      long sineVal = sine[0] + ((sine[1] - sine[0]) * (long)(dwPhase % 128)) / 128;
+      newLFOVal = (m_bModWheel[voice.bChannel] * 32 * sineVal + 16384) >> 15;
+   }
 
    // Linear envelope generator hack  (TODO: improve)
-   if ((m_wDrumMode & (1<<m_Voice[bVoice].bChannel)) > 0 &&
-       (m_Voice[bVoice].bOn || m_Voice[bVoice].bSusHeld)) {   // only continue it if the note is held
-       wTemp = gbPercMap[m_Voice[bVoice].bPatch-128].bPitchEGAmt & 0xFF;
+   if ((m_wDrumMode & (1<<voice.bChannel)) > 0 &&
+       (voice.bOn || voice.bSusHeld)) {   // only continue it if the note is held
+       wTemp = m_pBank->percMap[voice.bPatch-128].bPitchEGAmt & 0xFF;
        if (wTemp > 0)
        {
-           newDetuneEG = (long)((signed char)wTemp * 0.25 * (timeDiff));
+           newDetuneEG = (long)((Bit64s)(signed char)wTemp * timeDiff / 4);
        }
    }
 
-   if (newLFOVal == m_Voice[bVoice].dwLFOVal && newDetuneEG == m_Voice[bVoice].dwDetuneEG
-      && m_Voice[bVoice].dwPortaSampCnt == 0 && noteDiff == 0)
+   if (newLFOVal == voice.dwLFOVal && newDetuneEG == voice.dwDetuneEG && !bPorta)
       return;
 
-   m_Voice[bVoice].dwLFOVal = newLFOVal;
-   m_Voice[bVoice].dwDetuneEG = newDetuneEG;
+   voice.dwLFOVal = newLFOVal;
+   voice.dwDetuneEG = newDetuneEG;
 
    // Hax
-   newLFOVal += newDetuneEG + (8192*m_Voice[ bVoice ].wCoarseTune*100) + (40.96*m_Voice[ bVoice ].wFineTune);
+   newLFOVal += newDetuneEG + (8192*voice.wCoarseTune*100) + (voice.wFineTune*4096/100);
 
-   wTemp = Opl3_MIDINote2FNum((noteDiff)?noteDiff:m_Voice[ bVoice ].bNote,
-      m_Voice[bVoice].bChannel, newLFOVal);
-   m_Voice[ bVoice ].bBlock[ 0 ] =
-      (m_Voice[ bVoice ].bBlock[ 0 ] & (BYTE) 0xe0) |
+   wTemp = Opl3_Pitch2FNum(notePitch + Opl3_ChannelPitch(voice.bChannel) + newLFOVal);
+   voice.bBlock[ 0 ] =
+      (voice.bBlock[ 0 ] & (BYTE) 0xe0) |
       (BYTE) (wTemp >> 8) ;
 
+   // Depends if voice is enabled or not
+   if (voice.bOn == false)
+      wTemp &= ~(1<<5);
+
+   // Skip the writes if the registers hold these values already
+   WORD wReg = (voice.bBlock[ 0 ] << 8) | (BYTE) wTemp;
+   if (m_wPitchReg[bVoice] == wReg)
+      return;
+
    wOffset = bVoice;
    if (bVoice >= (NUM2VOICES / 2))
       wOffset += (0x100 - (NUM2VOICES / 2));
 
-   // Depends if voice is enabled or not
-   if (m_Voice[bVoice].bOn == false)
-      wTemp &= ~(1<<5);
-
-   Opl3_ChipWrite(AD_BLOCK + wOffset, m_Voice[ bVoice ].bBlock[ 0 ] ) ;
+   Opl3_ChipWrite(AD_BLOCK + wOffset, voice.bBlock[ 0 ] ) ;
    Opl3_ChipWrite(AD_FNUMBER + wOffset, (BYTE) wTemp ) ;
+   m_wPitchReg[bVoice] = wReg;
 
 } // end of Opl3_PitchBend
 
 void
    OPLSynth::
-   GetSample(t_float *left, t_float *right, unsigned len)
+   Opl3_PitchUpdate()
 {
-   BYTE i;
-
-   // Perform stepping of pitch LFO
-   //for (i = 0; i < len; ++i)
-   //{
-   //   if (i%(FSAMP/100)==0)
-   //   {
    // Step through each channel
-   for (i = 0; i < NUM2VOICES; i++)
+   for (BYTE i = 0; i < NUM2VOICES; i++)
    {
       // Only execute once initialized
       if (m_Voice[i].bChannel != (BYTE)~0)
          Opl3_LFOUpdate(i);
    }
-      //}
-   //}
+}
+
+void
+   OPLSynth::
+   SetPitchPeriod(unsigned chipSamples)
+{
+   chipSamples = std::max(1u, std::min<unsigned>(chipSamples, PITCH_PERIOD_MAX));
+   m_uPitchPeriod = std::max(1u, (chipSamples * m_uRate + FSAMP / 2) / FSAMP);
+   m_uPitchCount = 0;
+}
+
+unsigned
+   OPLSynth::
+   GetFreeVoices() const
+{
+   unsigned count = 0;
+
+   for (unsigned i = 0; i < NUM2VOICES; ++i)
+   {
+      if (!m_Voice[i].bOn && !m_Voice[i].bSusHeld)
+         ++count;
+   }
+
+   return count;
+}
+
+bool
+   OPLSynth::
+   Opl3_IsIdle() const
+{
+   enum { EG_OFF = 0 };  // envelope_gen_num_off of the Nuked core
+
+   for (unsigned i = 0; i < NUM2VOICES; ++i)
+   {
+      if (m_Voice[i].bOn || m_Voice[i].bSusHeld)
+         return false;
+   }
+
+   // Releases must have completed, and no register write be pending
+   const opl3_chip *chip = &m_Miniport;
+   for (unsigned i = 0; i < 36; ++i)
+   {
+      if (chip->slot[i].eg_gen != EG_OFF)
+         return false;
+   }
+   if (chip->writebuf[chip->writebuf_cur].reg & 0x200)
+      return false;
+
+   return true;
+}
+
+void
+   OPLSynth::
+   GetSample(t_float *left, t_float *right, unsigned len)
+{
+
+   // Nothing is sounding nor about to, skip the emulation until the next note
+   if (m_EventQueue.empty() && Opl3_IsIdle())
+   {
+      m_dwCurSample += len;
+      std::fill(left, left + len, 0);
+      std::fill(right, right + len, 0);
+      return;
+   }
+
+   // Render up to each event, and play it at its sample position,
+   // stepping the pitch LFO and portamento at regular periods
+   unsigned pos = 0;
+   for (;;)
+   {
+      const MidiEvent *ev;
+      while ((ev = m_EventQueue.front()) && (ev->dwFrame <= pos || pos == len))
+      {
+         switch (ev->dwData & EVENT_KIND)
+         {
+         case EVENT_REGISTER:
+            Opl3_ChipWrite((ev->dwData >> 8) & 0x1ff, (BYTE)ev->dwData);
+            break;
+         case EVENT_SNAPSHOT:
+            SaveSnapshot(ev->dwData & ~EVENT_KIND);
+            break;
+         case EVENT_RESTORE:
+            RestoreSnapshot(ev->dwData & ~EVENT_KIND);
+            break;
+         case EVENT_SYSEX:
+         {
+            DWORD len = ev->dwData & ~EVENT_KIND;
+            m_SysexQueue.read(m_bSysexBuf, len);
+            PlaySysex(m_bSysexBuf, len);
+            break;
+         }
+         default:
+            WriteMidiData(ev->dwData);
+            break;
+         }
+         m_EventQueue.pop();
+      }
+      if (pos == len)
+         break;
+      if (m_uPitchCount == 0)
+      {
+         Opl3_PitchUpdate();
+         m_uPitchCount = m_uPitchPeriod;
+      }
+      unsigned end = (ev && ev->dwFrame < len) ? ev->dwFrame : len;
+      end = std::min(end, pos + m_uPitchCount);
+      RenderSamples(left + pos, right + pos, end - pos);
+      m_dwCurSample += end - pos;
+      m_uPitchCount -= end - pos;
+      pos = end;
+   }
+}
 
-   m_dwCurSample += len;
+void
+   OPLSynth::
+   RenderSamples(t_float *left, t_float *right, unsigned len)
+{
+   if (m_bQuality == RSM_QUALITY_LINEAR)
+   {
+      for (unsigned i = 0; i < len; ++i) {
+          Bit16s outp[2];
+          OPL3_GenerateResampled(&m_Miniport, outp);
+          left[i] = outp[0] * (1/(t_float)32768);
+          right[i] = outp[1] * (1/(t_float)32768);
+      }
+      return;
+   }
+
+   // Run the chip at its own rate for as many samples as the
+   // resampler requires, then convert
+   polyphase_resampler<t_float> &rsm = m_Resampler;
+   for (unsigned i = 0; i < len; ) {
+      unsigned count = std::min<unsigned>(len - i, RSM_MAXBLOCK);
+      unsigned needed = rsm.input_needed(count);
+      GenerateChip(rsm.input(0), rsm.input(1), needed);
+      t_float *outp[2] = { left + i, right + i };
+      rsm.process(needed, outp, count);
+      i += count;
+   }
+}
+
+bool
+   OPLSynth::
+   QueueMidiData(DWORD dwData, DWORD dwFrame)
+{
+   MidiEvent ev;
+   ev.dwFrame = dwFrame;
+   ev.dwData = dwData;
+   return m_EventQueue.push(ev);
+}
+
+bool
+   OPLSynth::
+   QueueChipWrite(WORD idx, BYTE val, DWORD dwFrame)
+{
+   MidiEvent ev;
+   ev.dwFrame = dwFrame;
+   ev.dwData = EVENT_REGISTER | ((idx & 0x1ff) << 8) | val;
+   return m_EventQueue.push(ev);
+}
+
+bool
+   OPLSynth::
+   QueueSysex(const Bit8u *bufpos, DWORD len, DWORD dwFrame)
+{
+   // The contents first, which the render loop reads when it gets the event
+   if (len > SYSEX_MAX || m_EventQueue.full() || !m_SysexQueue.write(bufpos, len))
+      return false;
+   MidiEvent ev;
+   ev.dwFrame = dwFrame;
+   ev.dwData = EVENT_SYSEX | len;
+   return m_EventQueue.push(ev);
+}
+
+void
+   OPLSynth::
+   AllocSnapshots(unsigned count)
+{
+   m_pSnapshots.reset(new SynthState[count]);
+   m_uNumSnapshots = count;
+   for (unsigned i = 0; i < count; ++i)
+      m_pSnapshots[i].bValid = false;
+}
+
+// Apply a function to each part of the state and its saved copy
+template <class Fn>
+void
+   OPLSynth::
+   Opl3_StateFields(SynthState &st, Fn fn)
+{
+   fn(st.chip, m_Miniport);
+   fn(st.uPitchCount, m_uPitchCount);
+   fn(st.wPitchReg, m_wPitchReg);
+   fn(st.bChipReg, m_bChipReg);
+   fn(st.voice, m_Voice);
+   fn(st.bVoiceID, m_bVoiceID);
+   fn(st.dwCurTime, m_dwCurTime);
+   fn(st.wSynthAttenL, m_wSynthAttenL);
+   fn(st.wSynthAttenR, m_wSynthAttenR);
+   fn(st.bMasterCoarseTune, m_bMasterCoarseTune);
+   fn(st.dwMasterTune, m_dwMasterTune);
+   fn(st.bRPNCount, m_bRPNCount);
+   fn(st.bNRPNCount, m_bNRPNCount);
+   fn(st.SavedVolValue, m_SavedVolValue);
+   fn(st.bChanAtten, m_bChanAtten);
+   fn(st.bStereoMask, m_bStereoMask);
+   fn(st.iBend, m_iBend);
+   fn(st.iExpThres, m_iExpThres);
+   fn(st.curVol, m_curVol);
+   fn(st.RPN, m_RPN);
+   fn(st.NRPN, m_NRPN);
+   fn(st.bDataEnt, m_bDataEnt);
+   fn(st.iBendRange, m_iBendRange);
+   fn(st.bModWheel, m_bModWheel);
+   fn(st.bCoarseTune, m_bCoarseTune);
+   fn(st.bFineTune, m_bFineTune);
+   fn(st.wMonoMode, m_wMonoMode);
+   fn(st.wDrumMode, m_wDrumMode);
+   fn(st.wPortaMode, m_wPortaMode);
+   fn(st.bPortaTime, m_bPortaTime);
+   fn(st.bLastVoiceUsed, m_bLastVoiceUsed);
+   fn(st.bLastNoteUsed, m_bLastNoteUsed);
+   fn(st.bBankSelect, m_bBankSelect);
+   fn(st.bPatch, m_bPatch);
+   fn(st.bSustain, m_bSustain);
+   fn(st.bSostenuto, m_bSostenuto);
+   fn(st.bAttack, m_bAttack);
+   fn(st.bDecay, m_bDecay);
+   fn(st.bRelease, m_bRelease);
+   fn(st.bBrightness, m_bBrightness);
+   fn(st.b4OpVoiceSet, b4OpVoiceSet);
+   fn(st.MIDIMode, m_MIDIMode);
+   fn(st.bSysexDeviceId, m_bSysexDeviceId);
+}
 
-   for (unsigned i = 0; i < len; ++i) {
-       Bit16s outp[2];
-       OPL3_GenerateResampled(&m_Miniport, outp);
-       left[i] = outp[0] * (1/(t_float)32768);
-       right[i] = outp[1] * (1/(t_float)32768);
+bool
+   OPLSynth::
+   SaveSnapshot(unsigned slot)
+{
+   if (slot >= m_uNumSnapshots)
+      return false;
+
+   SynthState &st = m_pSnapshots[slot];
+   Opl3_StateFields(st, [](auto &saved, const auto &cur) {
+      memcpy(&saved, &cur, sizeof(cur));
+   });
+
+   // Held notes, the most recent ones if too many
+   for (unsigned i = 0; i < NUMMIDICHN; ++i)
+   {
+      const std::vector<BYTE> &hist = m_noteHistory[i];
+      const std::vector<BYTE> &sos = m_sostenutoBuffer[i];
+      size_t nhist = std::min<size_t>(hist.size(), SNAPSHOT_HISTORY_MAX);
+      size_t nsos = std::min<size_t>(sos.size(), SNAPSHOT_HISTORY_MAX);
+      std::copy(hist.end() - nhist, hist.end(), st.bNoteHistory[i]);
+      std::copy(sos.end() - nsos, sos.end(), st.bSostenutoBuffer[i]);
+      st.wNoteHistoryLen[i] = nhist;
+      st.wSostenutoLen[i] = nsos;
    }
+
+   st.dwSample = m_dwCurSample;
+   st.bValid = true;
+   return true;
+}
+
+bool
+   OPLSynth::
+   RestoreSnapshot(unsigned slot)
+{
+   if (slot >= m_uNumSnapshots || !m_pSnapshots[slot].bValid)
+      return false;
+
+   // The capture needs the registers which change
+   BYTE bPrevReg[0x200];
+   if (m_pCapture)
+      memcpy(bPrevReg, m_bChipReg, sizeof(bPrevReg));
+
+   // The chip points into itself, so the state only belongs to this one
+   SynthState &st = m_pSnapshots[slot];
+   Opl3_StateFields(st, [](const auto &saved, auto &cur) {
+      memcpy(&cur, &saved, sizeof(cur));
+   });
+
+   // Within the capacity reserved at init, without allocating
+   for (unsigned i = 0; i < NUMMIDICHN; ++i)
+   {
+      m_noteHistory[i].assign(
+         st.bNoteHistory[i], st.bNoteHistory[i] + st.wNoteHistoryLen[i]);
+      m_sostenutoBuffer[i].assign(
+         st.bSostenutoBuffer[i], st.bSostenutoBuffer[i] + st.wSostenutoLen[i]);
+   }
+
+   // The time goes on, the envelopes and LFO resume where they were
+   DWORD dwShift = m_dwCurSample - st.dwSample;
+   for (unsigned i = 0; i < NUM2VOICES; ++i)
+      m_Voice[i].dwStartTime += dwShift;
+
+   if (m_pCapture)
+      Opl3_LogRegisters(bPrevReg);
+
+   return true;
+}
+
+bool
+   OPLSynth::
+   QueueSnapshot(unsigned slot, bool bRestore, DWORD dwFrame)
+{
+   MidiEvent ev;
+   ev.dwFrame = dwFrame;
+   ev.dwData = (bRestore ? EVENT_RESTORE : EVENT_SNAPSHOT) | (slot & ~EVENT_KIND);
+   return m_EventQueue.push(ev);
+}
+
+void
+   OPLSynth::
+   SetCapture(CaptureLog *log)
+{
+   m_pCapture = log;
+   m_dwCaptureStart = m_dwCurSample;
+
+   // Begin with the current state of the chip, from a reset chip
+   static const BYTE bResetReg[0x200] = {};
+   if (log)
+      Opl3_LogRegisters(bResetReg);
+}
+
+void
+   OPLSynth::
+   Opl3_LogRegisters(const BYTE *bPrevReg)
+{
+   // Log the registers which differ from the previous state, the mode
+   // first and the key-on last
+   auto logReg = [bPrevReg, this](WORD idx) {
+      if (m_bChipReg[idx] != bPrevReg[idx])
+         Opl3_LogWrite(idx, m_bChipReg[idx]);
+   };
+   logReg(AD_NEW);
+   logReg(AD_CONNECTION);
+   for (WORD idx = 0; idx < 0x200; ++idx)
+   {
+      BYTE reg = (BYTE)idx;
+      if (idx != AD_NEW && idx != AD_CONNECTION && (BYTE)(reg - AD_BLOCK) >= 9)
+         logReg(idx);
+   }
+   for (WORD idx = 0; idx < 9; ++idx)
+   {
+      logReg(AD_BLOCK + idx);
+      logReg(AD_BLOCK2 + idx);
+   }
+}
+
+void
+   OPLSynth::
+   Opl3_LogWrite(WORD idx, BYTE val)
+{
+   // Without allocating, in the ring emptied by the other side; once full,
+   // the log stops rather than leave out some writes
+   if (m_pCapture->bOverflow.load(std::memory_order_relaxed))
+      return;
+   RegWrite wr;
+   wr.dwSample = m_dwCurSample - m_dwCaptureStart;
+   wr.wReg = idx;
+   wr.bVal = val;
+   if (!m_pCapture->ring.push(wr))
+      m_pCapture->bOverflow.store(true, std::memory_order_relaxed);
+}
+
+void
+   OPLSynth::
+   GenerateChip(t_float *left, t_float *right, unsigned len)
+{
+   Bit16s outp[2 * RSM_MAXBLOCK];
+
+   for (unsigned i = 0; i < len; ) {
+       unsigned count = std::min<unsigned>(len - i, RSM_MAXBLOCK);
+       OPL3_GenerateBlock(&m_Miniport, outp, count);
+       for (unsigned j = 0; j < count; ++j) {
+           left[i + j] = outp[2 * j] * (1/(t_float)32768);
+           right[i + j] = outp[2 * j + 1] * (1/(t_float)32768);
+       }
+       i += count;
+   }
+}
+
+void
+   OPLSynth::
+   SetQuality(unsigned quality)
+{
+   if (quality >= RSM_QUALITY_COUNT)
+      quality = RSM_QUALITY_COUNT - 1;
+
+   if (quality != RSM_QUALITY_LINEAR)
+   {
+      const resampler_preset &preset =
+         resampler_get_preset((resampler_quality)(quality - 1));
+      m_Resampler = polyphase_resampler<t_float>(
+         FSAMP, m_uRate, preset, 2, RSM_MAXBLOCK);
+   }
+
+   m_bQuality = quality;
+}
+
+unsigned
+   OPLSynth::
+   GetLatency() const
+{
+   if (m_bQuality == RSM_QUALITY_LINEAR)
+      return 0;
+
+   // in output samples, rounded up
+   return (m_Resampler.latency() * m_uRate + FSAMP - 1) / FSAMP;
 }
 
 
@@ -2590,7 +3088,7 @@ void
              break;
 
          // Set the patch
-         glpPatch[insno] = patch;
+         Opl3_EditBank().patch[insno] = patch;
       }
       else if (!memcmp(tag, "OP3MLMAP", 8))
       {
@@ -2621,7 +3119,7 @@ void
          /**/
 
          // Set it
-         gbMelMap[insno] = map;
+         Opl3_EditBank().melMap[insno] = map;
       }
       else if (!memcmp(tag, "OP3PCMAP", 8))
       {
@@ -2645,12 +3143,35 @@ void
              break;
 
          // Set it
-         gbPercMap[insno] = map;
+         Opl3_EditBank().percMap[insno] = map;
       }
       break;
    }
 }
 
+void
+   OPLSynth::
+   SetBank(const OPLBank *bank)
+{
+   // The bank is shared, it only changes by a swap of pointer,
+   // and the edits of the previous one are dropped
+   m_pBank = bank ? bank : &gDefaultBank;
+}
+
+OPLBank&
+   OPLSynth::
+   Opl3_EditBank(void)
+{
+   // Edit an own copy of the bank, made at the first change
+   // into the storage allocated by Init
+   if (m_pBank != m_pEditBank.get())
+   {
+      *m_pEditBank = *m_pBank;
+      m_pBank = m_pEditBank.get();
+   }
+   return *m_pEditBank;
+}
+
 void
    OPLSynth::
    Opl3_SoftCommandReset()
@@ -2707,6 +3228,16 @@ inline void
    OPLSynth::
    Opl3_ChipWrite(WORD idx, BYTE val)
 {
+   // A pitch register changes outside the pitch engine
+   BYTE reg = (BYTE)idx;
+   if ((BYTE)(reg - AD_FNUMBER) < 9 || (BYTE)(reg - AD_BLOCK) < 9)
+      m_wPitchReg[(reg & 0x0f) + ((idx & 0x100) ? 9 : 0)] = (WORD)~0;
+
+   // Keep the state, and log for the capture
+   m_bChipReg[idx & 0x1ff] = val;
+   if (m_pCapture)
+      Opl3_LogWrite(idx, val);
+
    // Write to software chip
    OPL3_WriteReg(&m_Miniport, idx, val);
 }
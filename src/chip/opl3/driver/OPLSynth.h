@@ -12,7 +12,12 @@
 #pragma once
 #include "OPLPatch.h"
 #include "../nukedopl/opl3.h"
+#include "util/dsp/resampler.h"
+#include "util/spsc_queue.h"
+#include "util/spsc_ring.h"
 #include <m_pd.h>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <stdint.h>
 
@@ -106,6 +111,7 @@ struct Voice
    DWORD dwPortaSampTime;
    //BYTE   bPortaSampCnt;
    DWORD dwPortaSampCnt;
+   WORD  wPortaFrac;               /* progress into the next step, in 1/64 */
 
    short wCoarseTune;
    short wFineTune;
@@ -113,11 +119,117 @@ struct Voice
 };
 
 
+/* saved state of the chip and the channels, to recall at once */
+enum {
+   SNAPSHOT_HISTORY_MAX = 256,     /* held notes kept per channel */
+};
+
+struct SynthState
+{
+   bool    bValid;
+   DWORD   dwSample;               /* time when saved */
+   opl3_chip chip;
+   unsigned uPitchCount;
+   WORD    wPitchReg[NUM2VOICES];
+   BYTE    bChipReg[0x200];
+   Voice   voice[NUM2VOICES];
+   BYTE    bVoiceID;
+   DWORD   dwCurTime;
+   WORD    wSynthAttenL;
+   WORD    wSynthAttenR;
+   char    bMasterCoarseTune;
+   double  dwMasterTune;
+   WORD    wNoteHistoryLen[NUMMIDICHN];
+   BYTE    bNoteHistory[NUMMIDICHN][SNAPSHOT_HISTORY_MAX];
+   WORD    wSostenutoLen[NUMMIDICHN];
+   BYTE    bSostenutoBuffer[NUMMIDICHN][SNAPSHOT_HISTORY_MAX];
+   BYTE    bRPNCount[NUMMIDICHN];
+   BYTE    bNRPNCount[NUMMIDICHN];
+   LONG    SavedVolValue[2];
+   BYTE    bChanAtten[NUMMIDICHN];
+   BYTE    bStereoMask[NUMMIDICHN];
+   long    iBend[NUMMIDICHN];
+   BYTE    iExpThres[NUMMIDICHN];
+   BYTE    curVol[NUMMIDICHN];
+   BYTE    RPN[NUMMIDICHN][2];
+   BYTE    NRPN[NUMMIDICHN][2];
+   BYTE    bDataEnt[NUMMIDICHN][2];
+   BYTE    iBendRange[NUMMIDICHN];
+   BYTE    bModWheel[NUMMIDICHN];
+   BYTE    bCoarseTune[NUMMIDICHN];
+   BYTE    bFineTune[NUMMIDICHN];
+   WORD    wMonoMode;
+   WORD    wDrumMode;
+   WORD    wPortaMode;
+   BYTE    bPortaTime[NUMMIDICHN];
+   BYTE    bLastVoiceUsed[NUMMIDICHN];
+   BYTE    bLastNoteUsed[NUMMIDICHN];
+   BYTE    bBankSelect[NUMMIDICHN][2];
+   BYTE    bPatch[NUMMIDICHN];
+   BYTE    bSustain[NUMMIDICHN];
+   BYTE    bSostenuto[NUMMIDICHN];
+   BYTE    bAttack[NUMMIDICHN];
+   BYTE    bDecay[NUMMIDICHN];
+   BYTE    bRelease[NUMMIDICHN];
+   BYTE    bBrightness[NUMMIDICHN];
+   BYTE    b4OpVoiceSet;
+   BYTE    MIDIMode;
+   BYTE    bSysexDeviceId;
+};
+
 /* a bit of tuning information */
 enum {
    FSAMP = 49716 // (3579545.0 / 72.0) /* sampling frequency */
 };
 
+/* pitch engine */
+enum {
+   PITCH_PERIOD_DEFAULT = 32,      /* chip samples between updates of LFO and portamento */
+   PITCH_PERIOD_MAX     = 4096,
+   PITCH_UNIT           = 8192,    /* fixed-point pitch steps per semitone */
+};
+
+/* timestamped MIDI event */
+struct MidiEvent
+{
+   DWORD   dwFrame;                /* offset in the next block of output */
+   DWORD   dwData;                 /* short message, as for WriteMidiData */
+};
+
+enum {
+   MIDI_QUEUE_SIZE = 1024,
+   SYSEX_QUEUE_SIZE = 4096,        /* bytes of the queued sysex messages */
+   SYSEX_MAX       = 128,          /* longest sysex message which can be queued */
+   EVENT_KIND      = 0xff000000,   /* mask of dwData for the events other than MIDI */
+   EVENT_REGISTER  = 0x80000000,   /* chip write: reg << 8 | value */
+   EVENT_SNAPSHOT  = 0x81000000,   /* save the state to a slot: slot */
+   EVENT_RESTORE   = 0x82000000,   /* recall the state from a slot: slot */
+   EVENT_SYSEX     = 0x83000000,   /* sysex from the sysex queue: length */
+};
+
+/* chip write, as logged by the capture */
+struct RegWrite
+{
+   DWORD   dwSample;               /* output samples since the capture began */
+   WORD    wReg;
+   BYTE    bVal;
+};
+
+/* log of the capture, filled while rendering and emptied by another thread */
+struct CaptureLog
+{
+   spsc_queue<RegWrite> ring;
+   std::atomic<bool> bOverflow{false};   /* the ring was full, the log stopped */
+};
+
+/* output conversion */
+enum {
+   RSM_QUALITY_LINEAR  = 0,                      /* chip's own linear interpolation */
+   RSM_QUALITY_DEFAULT = 1 + resampler_medium,
+   RSM_QUALITY_COUNT   = 1 + resampler_quality_count,
+   RSM_MAXBLOCK        = 64,                     /* outputs converted at once */
+};
+
 /* operator offset location */
 static constexpr WORD gw2OpOffset[ NUM2VOICES ][ 2 ] =
 {
@@ -196,8 +308,33 @@ class OPLSynth
 private:
    opl3_chip m_Miniport{};
 
+   // output conversion
+   unsigned m_uRate = 0;             /* output sample rate */
+   BYTE    m_bQuality = 0;           /* 0 for the chip's linear resampler, or preset+1 */
+   polyphase_resampler<t_float> m_Resampler;
+
+   // events to play during the next block
+   spsc_queue<MidiEvent> m_EventQueue;
+   spsc_ring<BYTE> m_SysexQueue;     /* contents of the sysex events, in order */
+   BYTE    m_bSysexBuf[SYSEX_MAX];
+
+   // pitch engine, run every few samples
+   unsigned m_uPitchPeriod = 1;      /* output samples between updates */
+   unsigned m_uPitchCount = 0;       /* output samples until the next update */
+   WORD    m_wPitchReg[NUM2VOICES];  /* pitch registers as last written by the engine, or ~0 */
+
+   // chip registers as last written, and the log of writes if capturing
+   BYTE    m_bChipReg[0x200];
+   CaptureLog *m_pCapture = nullptr;
+   DWORD   m_dwCaptureStart = 0;
+
+   // slots of saved states, allocated in advance
+   std::unique_ptr<SynthState[]> m_pSnapshots;
+   unsigned m_uNumSnapshots = 0;
+
    // midi stuff
    Voice   m_Voice[NUM2VOICES]; /* info on what voice is where */
+   BYTE    m_bVoiceID = 0;     /* last identifier given to a note allocation */
    DWORD   m_dwCurTime;        /* for note on/off */
    DWORD   m_dwCurSample;      /* for software eg/lfo generators */
    /* volume */
@@ -255,10 +392,9 @@ private:
    BYTE    m_MIDIMode;                 /*System Exclusive MIDI command mode (TODO: dynamically set defaults)*/
    BYTE    m_bSysexDeviceId;           /*Device ID*/
 
-   /*bank defaults*/
-   std::array<MelMap, 128> gbMelMap = gbDefaultMelMap;
-   std::array<PercMap, 128> gbPercMap = gbDefaultPercMap;
-   std::array<Patch, 256> glpPatch = glpDefaultPatch;
+   /*bank in use, shared and not owned, or the own copy edited by sysex*/
+   const OPLBank *m_pBank = &gDefaultBank;
+   std::unique_ptr<OPLBank> m_pEditBank;
 
    void Opl3_ChannelVolume(BYTE bChannel, WORD wAtten);
    void Opl3_SetPan(BYTE bChannel, BYTE bPan);
@@ -271,7 +407,9 @@ private:
    void Opl3_ChannelNotesOff(BYTE bChannel);
    WORD Opl3_FindFullSlot(BYTE bNote, BYTE bChannel);
    //WORD Opl3_CalcFAndB (DWORD dwPitch);
-   WORD Opl3_MIDINote2FNum(double note, BYTE bChannel, long dwLFOVal);
+   WORD Opl3_MIDINote2FNum(BYTE note, BYTE bChannel, long dwLFOVal);
+   long Opl3_ChannelPitch(BYTE bChannel) const;
+   static WORD Opl3_Pitch2FNum(long lPitch);
    void Opl3_ProcessDataEntry(BYTE bChannel);
    void Opl3_Set4OpFlag(BYTE bVoice, bool bSetFlag, BYTE bOp);
    //DWORD Opl3_CalcBend (DWORD dwOrig, short iBend);
@@ -288,16 +426,38 @@ private:
    void Opl3_BoardReset(void);
    bool Opl3_IsPatchEmpty(BYTE bPatch);
    void Opl3_LFOUpdate(BYTE bVoice);
+   void Opl3_PitchUpdate(void);
    void ProcessGSSysEx(const Bit8u *bufpos, DWORD len);
    void ProcessXGSysEx(const Bit8u *bufpos, DWORD len);
    void ProcessMaliceXSysEx(const Bit8u *bufpos, DWORD len);
    Patch& Opl3_GetPatch(BYTE bBankMSB, BYTE bBankLSB, BYTE bPatch);
+   OPLBank& Opl3_EditBank(void);
+   void GenerateChip(t_float *left, t_float *right, unsigned len);
+   template <class Fn> void Opl3_StateFields(SynthState &st, Fn fn);
+   void Opl3_LogRegisters(const BYTE *bPrevReg);
+   void Opl3_LogWrite(WORD idx, BYTE val);
+   void RenderSamples(t_float *left, t_float *right, unsigned len);
 
 public:
    void Opl3_SoftCommandReset(void);
    void WriteMidiData(DWORD dwData);
+   bool QueueMidiData(DWORD dwData, DWORD dwFrame);
+   bool QueueChipWrite(WORD idx, BYTE val, DWORD dwFrame);
+   bool QueueSysex(const Bit8u *bufpos, DWORD len, DWORD dwFrame);
+   void SetCapture(CaptureLog *log);
+   void SetBank(const OPLBank *bank);
+   void AllocSnapshots(unsigned count);
+   bool SaveSnapshot(unsigned slot);
+   bool RestoreSnapshot(unsigned slot);
+   bool QueueSnapshot(unsigned slot, bool bRestore, DWORD dwFrame);
    bool Init(unsigned rate);
    void GetSample(t_float *left, t_float *right, unsigned len);
+   void SetQuality(unsigned quality);
+   void SetPitchPeriod(unsigned chipSamples);
+   unsigned GetLatency() const;
+   unsigned GetFreeVoices() const;
+   bool Opl3_IsIdle() const;
+   bool IsMonoMode(BYTE bChannel) const { return (m_wMonoMode & (1<<bChannel)) != 0; }
    void PlaySysex(const Bit8u *bufpos, DWORD len);
    inline void Opl3_ChipWrite(WORD idx, BYTE val);
    ~OPLSynth() { close(); }
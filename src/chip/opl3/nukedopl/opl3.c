@@ -666,6 +666,46 @@ static void OPL3_SlotCalcFB(opl3_slot *slot)
     slot->prout = slot->out;
 }
 
+//
+// A slot in the off state has its envelope at maximum attenuation, so the
+// exponential evaluates to zero whatever the waveform. Only the sign remains,
+// which some waveforms apply as a one's complement, yielding 0 or -1.
+//
+
+static void OPL3_SlotGenerateOff(opl3_slot *slot)
+{
+    Bit16u phase = (Bit16u)(slot->pg_phase >> 9) + *slot->mod;
+    Bit16u neg = 0;
+    phase &= 0x3ff;
+    switch (slot->reg_wf)
+    {
+    case 0:
+    case 6:
+    case 7:
+        neg = phase & 0x200;
+        break;
+    case 4:
+        neg = (phase & 0x300) == 0x100;
+        break;
+    }
+    slot->out = neg ? -1 : 0;
+}
+
+static void OPL3_SlotProcess(opl3_slot *slot)
+{
+    OPL3_SlotCalcFB(slot);
+    OPL3_PhaseGenerate(slot);
+    if (slot->eg_gen == envelope_gen_num_off)
+    {
+        // the envelope stays at 0x1ff until key on, and its output
+        // is recomputed before it is used again
+        OPL3_SlotGenerateOff(slot);
+        return;
+    }
+    OPL3_EnvelopeCalc(slot);
+    OPL3_SlotGenerate(slot);
+}
+
 //
 // Channel
 //
@@ -1087,7 +1127,7 @@ static void OPL3_GenerateRhythm2(opl3_chip *chip)
     OPL3_SlotGeneratePhase(channel8->slots[1], phase);
 }
 
-void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
+static void OPL3_GenerateCore(opl3_chip *chip, Bit16s *buf)
 {
     Bit8u ii;
     Bit8u jj;
@@ -1097,10 +1137,7 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
 
     for (ii = 0; ii < 12; ii++)
     {
-        OPL3_SlotCalcFB(&chip->slot[ii]);
-        OPL3_PhaseGenerate(&chip->slot[ii]);
-        OPL3_EnvelopeCalc(&chip->slot[ii]);
-        OPL3_SlotGenerate(&chip->slot[ii]);
+        OPL3_SlotProcess(&chip->slot[ii]);
     }
 
     for (ii = 12; ii < 15; ii++)
@@ -1154,10 +1191,7 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
 
     for (ii = 18; ii < 33; ii++)
     {
-        OPL3_SlotCalcFB(&chip->slot[ii]);
-        OPL3_PhaseGenerate(&chip->slot[ii]);
-        OPL3_EnvelopeCalc(&chip->slot[ii]);
-        OPL3_SlotGenerate(&chip->slot[ii]);
+        OPL3_SlotProcess(&chip->slot[ii]);
     }
 
     chip->mixbuff[1] = 0;
@@ -1173,10 +1207,7 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
 
     for (ii = 33; ii < 36; ii++)
     {
-        OPL3_SlotCalcFB(&chip->slot[ii]);
-        OPL3_PhaseGenerate(&chip->slot[ii]);
-        OPL3_EnvelopeCalc(&chip->slot[ii]);
-        OPL3_SlotGenerate(&chip->slot[ii]);
+        OPL3_SlotProcess(&chip->slot[ii]);
     }
 
     OPL3_NoiseGenerate(chip);
@@ -1200,7 +1231,10 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
     }
 
     chip->timer++;
+}
 
+static void OPL3_ProcessWriteBuf(opl3_chip *chip)
+{
     while (chip->writebuf[chip->writebuf_cur].time <= chip->writebuf_samplecnt)
     {
         if (!(chip->writebuf[chip->writebuf_cur].reg & 0x200))
@@ -1212,9 +1246,43 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
                       chip->writebuf[chip->writebuf_cur].data);
         chip->writebuf_cur = (chip->writebuf_cur + 1) % OPL_WRITEBUF_SIZE;
     }
+}
+
+// time of the next buffered write, or the maximum if there is none
+static Bit64u OPL3_NextWriteTime(opl3_chip *chip)
+{
+    if (!(chip->writebuf[chip->writebuf_cur].reg & 0x200))
+    {
+        return ~(Bit64u)0;
+    }
+    return chip->writebuf[chip->writebuf_cur].time;
+}
+
+void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
+{
+    OPL3_GenerateCore(chip, buf);
+    OPL3_ProcessWriteBuf(chip);
     chip->writebuf_samplecnt++;
 }
 
+void OPL3_GenerateBlock(opl3_chip *chip, Bit16s *sndptr, Bit32u numsamples)
+{
+    Bit32u i;
+    Bit64u nextwrite = OPL3_NextWriteTime(chip);
+
+    for (i = 0; i < numsamples; i++)
+    {
+        OPL3_GenerateCore(chip, sndptr);
+        if (chip->writebuf_samplecnt >= nextwrite)
+        {
+            OPL3_ProcessWriteBuf(chip);
+            nextwrite = OPL3_NextWriteTime(chip);
+        }
+        chip->writebuf_samplecnt++;
+        sndptr += 2;
+    }
+}
+
 void OPL3_GenerateResampled(opl3_chip *chip, Bit16s *buf)
 {
     while (chip->samplecnt >= chip->rateratio)
@@ -4,20 +4,190 @@
  */
 
 #include "opl3/driver/OPLSynth.h"
+#include "opl3/driver/OPLBank.h"
 #include "util/midi.h"
+#include "util/smf.h"
+#include "util/vgm.h"
+#include "util/spsc_queue.h"
+#include "util/spsc_ring.h"
+#include "util/worker_pool.h"
 #include "util/pd++.h"
 #include <jsl/math>
 #include <jsl/types>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <cassert>
+#include <cstring>
+
+static constexpr uint opl3_maxcards = 16;
+static constexpr u8 opl3_nocard = 0xff;
+// offline rendering: the longest release after the last event in seconds,
+// and the interval to check for completion in milliseconds
+static constexpr double opl3_rendertail = 10;
+static constexpr double opl3_renderpoll = 50;
+// capture: chip writes which the ring holds per card, and the interval to
+// move them out of it in milliseconds
+static constexpr uint opl3_capturering = 1 << 16;
+static constexpr double opl3_capturepoll = 20;
+// slots of saved states
+static constexpr uint opl3_numslots = 16;
+// rendering ahead: the most blocks of latency, and the capacity for events
+static constexpr uint opl3_maxlookahead = 64;
+static constexpr uint opl3_aheadevents = 4096;
+static constexpr uint opl3_aheadsysex = 4096;
+// the longest sysex message, as the cards can queue it in time order
+static constexpr uint opl3_maxsysex = SYSEX_MAX;
+// event for the worker only: a sysex of the given length, in the sysex ring
+static constexpr u32 opl3_event_sysex = 0x8f000000;
+
+// synths of a number of cards, with the routing of notes to them
+struct opl3_cards {
+    // one synth per card, each with a chip and 18 voices
+    std::unique_ptr<OPLSynth[]> opl;
+    uint count = 0;
+    uint next = 0;
+    // card which last received a note on, by channel and key
+    u8 notecard[16][128];
+};
+
+// routing of the notes at the time of a snapshot, the rest being in the cards
+struct opl3_saved {
+    bool valid = false;
+    uint next = 0;
+    u8 notecard[16][128];
+};
+
+// offline rendering of a MIDI file, in its own thread
+struct opl3_offline {
+    std::thread thread;
+    std::atomic<bool> done{false};
+    std::atomic<bool> cancel{false};
+    // settings
+    std::string path;
+    t_symbol *leftarray = nullptr;
+    t_symbol *rightarray = nullptr;
+    uint rate = 0;
+    uint numcards = 0;
+    uint quality = 0;
+    uint pitchperiod = 0;
+    std::shared_ptr<const OPLBank> bank;
+    // result
+    std::vector<t_float> left;
+    std::vector<t_float> right;
+    std::string error;
+
+    ~opl3_offline();
+};
+
+// playback of a stream of chip writes, in sync with the output
+struct opl3_player {
+    VGM_Stream stream;
+    uint rate = 0;
+    // output samples played, and the write which comes next
+    u64 position = 0;
+    VGM_Write next;
+    bool pending = false;
+    bool finished = false;
+};
+
+// event for the cards, as a short MIDI message, a snapshot or a sysex event
+struct opl3_event {
+    u64 time;             // frame of output at which it applies
+    u32 data;             // as OPLSynth MidiEvent
+};
+
+// rendering of the cards ahead of the output, by a thread of its own, so
+// that the DSP routine only has to copy
+struct opl3_ahead {
+    std::thread thread;
+    std::atomic<bool> quit{false};
+    // held by the worker while it uses the cards
+    std::mutex mutex;
+    // signaled when some output has been consumed
+    std::mutex wakemutex;
+    std::condition_variable wake;
+    // size and number of blocks rendered in advance
+    uint blocksize = 0;
+    uint blocks = 0;
+    // output blocks, left then right, preceded by the latency as silence
+    spsc_ring<t_float> ring;
+    std::unique_ptr<t_float[]> buffer;
+    // events for the worker, in time order
+    spsc_queue<opl3_event> events;
+    // contents of the sysex events, in the same order
+    spsc_ring<u8> sysex;
+    std::unique_ptr<u8[]> sysexbuf;
+    // frames read by the DSP routine, and frames rendered by the worker
+    u64 reads = 0;
+    u64 position = 0;
+
+    void join();
+    ~opl3_ahead() { join(); }
+};
 
 struct t_opl3 : pd_basic_object<t_opl3> {
-    OPLSynth x_opl;
+    // instruments loaded from a file, shared with other instances, and
+    // which outlive the cards
+    std::shared_ptr<const OPLBank> x_bank;
+    opl3_cards x_cards;
+    uint x_rate = 0;
+    // threads rendering the cards other than the first
+    std::unique_ptr<worker_pool> x_pool;
+    // output of the cards other than the first, left and right
+    pd_dynarray<t_float> x_cardbuf;
+    // logical time and size of the last block, to timestamp the events
+    double x_blocktime = 0;
+    uint x_blocksize = 0;
+    // settings, for the offline rendering to use the same
+    uint x_quality = RSM_QUALITY_DEFAULT;
+    uint x_pitchperiod = PITCH_PERIOD_DEFAULT;
+    // offline rendering in progress, and the clock which checks on it
+    std::unique_ptr<opl3_offline> x_render;
+    u_clock x_renderclock;
+    // capture of the chip writes, up to 2 cards, saved at the end
+    bool x_capturing = false;
+    std::string x_capturepath;
+    CaptureLog x_capturering[2];
+    std::vector<RegWrite> x_capturelog[2];
+    u64 x_capturelength = 0;
+    u_clock x_captureclock;
+    // playback of chip writes
+    std::unique_ptr<opl3_player> x_player;
+    // saved states
+    std::unique_ptr<opl3_saved[]> x_slots;
+    // rendering ahead, if enabled and running, which is stopped before
+    // all the above is destroyed
+    uint x_lookahead = 0;
+    std::unique_ptr<opl3_ahead> x_ahead;
+    u_clock x_latencyclock;
+    t_canvas *x_canvas = nullptr;
     uint x_ins = 0;
     MIDI_Parser x_midiparse;
     u_outlet x_otl_left;
     u_outlet x_otl_right;
+    u_outlet x_otl_done;
 };
 
+static void opl3_cards_init(opl3_cards &cards, uint count, uint rate)
+{
+    cards.opl.reset(new OPLSynth[count]);
+    cards.count = count;
+    cards.next = 0;
+    for (uint i = 0; i < count; ++i)
+        cards.opl[i].Init(rate);
+    std::memset(cards.notecard, opl3_nocard, sizeof(cards.notecard));
+}
+
+static void opl3_offline_tick(t_opl3 *x);
+static void opl3_latency_tick(t_opl3 *x);
+static void opl3_capture_tick(t_opl3 *x);
+
 static void *opl3_new(t_symbol *s, int argc, t_atom argv[])
 {
     u_pd<t_opl3> x;
@@ -25,25 +195,37 @@ static void *opl3_new(t_symbol *s, int argc, t_atom argv[])
     try {
         x = pd_make_instance<t_opl3>();
 
-        uint numcards = 2;  // TODO param
+        uint numcards = 1;
         switch (argc) {
             case 1: numcards = (int)atom_getfloatarg(0, argc, argv);  // fall through
             case 0: break;
             default: return nullptr;
         }
 
-        if ((int)numcards < 1)
+        if ((int)numcards < 1 || numcards > opl3_maxcards)
             return nullptr;
 
         t_float fs = sys_getsr();
 
-        OPLSynth &opl = x->x_opl;
-        opl.Init(fs);
+        opl3_cards_init(x->x_cards, numcards, fs);
+        x->x_rate = fs;
+
+        x->x_slots.reset(new opl3_saved[opl3_numslots]);
+        for (uint i = 0; i < numcards; ++i)
+            x->x_cards.opl[i].AllocSnapshots(opl3_numslots);
 
-        x->x_midiparse.buffer(128);
+        x->x_pool.reset(new worker_pool(numcards - 1));
+
+        x->x_midiparse.buffer(opl3_maxsysex);
+
+        x->x_canvas = canvas_getcurrent();
+        x->x_renderclock.reset(clock_new(x.get(), (t_method)&opl3_offline_tick));
+        x->x_latencyclock.reset(clock_new(x.get(), (t_method)&opl3_latency_tick));
+        x->x_captureclock.reset(clock_new(x.get(), (t_method)&opl3_capture_tick));
 
         x->x_otl_left.reset(outlet_new(&x->x_obj, &s_signal));
         x->x_otl_right.reset(outlet_new(&x->x_obj, &s_signal));
+        x->x_otl_done.reset(outlet_new(&x->x_obj, &s_anything));
     }
     catch (std::exception &ex) {
         error("%s", ex.what());
@@ -53,33 +235,904 @@ static void *opl3_new(t_symbol *s, int argc, t_atom argv[])
     return x.release();
 }
 
+struct opl3_render_job {
+    t_opl3 *x;
+    uint n;
+    t_sample *left;
+    t_sample *right;
+};
+
+static void opl3_render_card(void *arg, uint card)
+{
+    const opl3_render_job &job = *(const opl3_render_job *)arg;
+    t_opl3 *x = job.x;
+    const uint n = job.n;
+
+    t_sample *left = job.left, *right = job.right;
+    if (card > 0) {
+        left = &x->x_cardbuf[2 * n * (card - 1)];
+        right = left + n;
+    }
+    x->x_cards.opl[card].GetSample(left, right, n);
+}
+
+// queue the chip writes of the stream which fall in the next block
+static void opl3_play_block(t_opl3 *x, uint n)
+{
+    opl3_player &pl = *x->x_player;
+    const u64 end = pl.position + n;
+
+    while (!pl.finished) {
+        if (!pl.pending && !(pl.pending = pl.stream.next(pl.next))) {
+            pl.finished = true;
+            break;
+        }
+        const VGM_Write &wr = pl.next;
+        u64 frame = ((u64)wr.time * pl.rate + vgm_rate / 2) / vgm_rate;
+        if (frame >= end)
+            break;
+        frame = (frame > pl.position) ? (frame - pl.position) : 0;
+        // the second chip of a pair goes to the second card, if any
+        if (wr.chip < x->x_cards.count &&
+            !x->x_cards.opl[wr.chip].QueueChipWrite(wr.reg, wr.val, frame))
+            break;  // full, continue in the next block
+        pl.pending = false;
+    }
+
+    pl.position = end;
+}
+
+// produce the next block of all the cards
+static void opl3_process(t_opl3 *x, const uint n, t_sample *left, t_sample *right)
+{
+    const uint numcards = x->x_cards.count;
+
+    if (x->x_player)
+        opl3_play_block(x, n);
+    if (x->x_capturing)
+        x->x_capturelength += n;
+
+    opl3_render_job job;
+    job.x = x;
+    job.n = n;
+    job.left = left;
+    job.right = right;
+    x->x_pool->run(&opl3_render_card, &job);
+
+    // mix the cards together
+    for (uint card = 1; card < numcards; ++card) {
+        const t_float *cardleft = &x->x_cardbuf[2 * n * (card - 1)];
+        const t_float *cardright = cardleft + n;
+#pragma omp simd
+        for (uint i = 0; i < n; ++i) {
+            left[i] += cardleft[i];
+            right[i] += cardright[i];
+        }
+    }
+}
+
 static void opl3_perform(
     t_opl3 *x, const uint n, t_sample *left, t_sample *right)
 {
-    OPLSynth &opl = x->x_opl;
-    // TODO higher quality resampling?
-    opl.GetSample(left, right, n);
+    // the messages which follow belong to the next block
+    x->x_blocktime = clock_getlogicaltime();
+
+    opl3_ahead *a = x->x_ahead.get();
+    if (!a) {
+        opl3_process(x, n, left, right);
+        return;
+    }
+
+    // rendered in advance, or silence if the worker is late
+    if (a->ring.read_space() < 2 * n) {
+        std::fill(left, left + n, 0);
+        std::fill(right, right + n, 0);
+        return;
+    }
+    a->ring.read(left, n);
+    a->ring.read(right, n);
+    a->reads += n;
+    a->wake.notify_one();
 }
 
+static void opl3_ahead_start(t_opl3 *x);
+static void opl3_ahead_stop(t_opl3 *x);
+
 static void opl3_dsp(t_opl3 *x, t_signal **sp)
 {
-    dsp_add_s(opl3_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+    const uint n = sp[0]->s_n;
+
+    // the worker uses the buffers, restart it for the new block size
+    opl3_ahead_stop(x);
+
+    const uint nbuf = 2 * n * (x->x_cards.count - 1);
+    if (x->x_cardbuf.size() != nbuf)
+        x->x_cardbuf.reset(nbuf);
+    x->x_blocksize = n;
+
+    if (x->x_lookahead > 0) {
+        opl3_ahead_start(x);
+        clock_delay(x->x_latencyclock.get(), 0);
+    }
+
+    dsp_add_s(opl3_perform, x, n, sp[0]->s_vec, sp[1]->s_vec);
 }
 
-static void opl3_midi(t_opl3 *x, t_float f)
+// choose a card for a new note: the one which has the most free voices, the
+// ties broken in rotation so that the cards share the work of rendering
+static uint opl3_allocate_card(opl3_cards &cards, uint channel, uint key)
 {
-    OPLSynth &opl = x->x_opl;
-    const MIDI_Message msg = x->x_midiparse.process(f);
-    if (msg) {
-        if (msg.data[0] == 0xf0)
+    const uint numcards = cards.count;
+
+    // retrigger on the same card, and keep mono channels together
+    uint card = cards.notecard[channel][key];
+    if (card != opl3_nocard)
+        return card;
+    if (cards.opl[0].IsMonoMode(channel))
+        return 0;
+
+    uint bestfree = 0;
+    card = cards.next;
+    for (uint i = 0; i < numcards; ++i) {
+        uint current = (cards.next + i) % numcards;
+        uint free = cards.opl[current].GetFreeVoices();
+        if (free > bestfree) {
+            card = current;
+            bestfree = free;
+        }
+    }
+    cards.next = (card + 1) % numcards;
+    return card;
+}
+
+// position of the current message in the block to come
+static uint opl3_frame(t_opl3 *x)
+{
+    const uint n = x->x_blocksize;
+    double elapsed = clock_gettimesincewithunits(x->x_blocktime, 1, 1);
+    if (n == 0 || !(elapsed > 0))
+        return 0;
+    return (elapsed < n) ? (uint)elapsed : (n - 1);
+}
+
+// play at a frame of the next block, or at once if the frame is negative
+static void opl3_send(OPLSynth &opl, uint32_t word, int frame)
+{
+    if (frame < 0 || !opl.QueueMidiData(word, frame))
+        opl.WriteMidiData(word);
+}
+
+static void opl3_dispatch(opl3_cards &cards, const MIDI_Message &msg, int frame)
+{
+    const uint numcards = cards.count;
+
+    if (msg.data[0] == 0xf0) {
+        // in order with the messages queued before it
+        for (uint card = 0; card < numcards; ++card) {
+            OPLSynth &opl = cards.opl[card];
+            if (frame < 0 || !opl.QueueSysex(msg.data, msg.length, frame))
                 opl.PlaySysex(msg.data, msg.length);
+        }
+    }
+    else {
+        uint32_t word = 0;
+        for (uint i = 0; i < msg.length; ++i)
+            word |= msg.data[i] << (8*i);
+
+        const uint status = msg.data[0] & 0xf0;
+        const uint channel = msg.data[0] & 0x0f;
+        if (status == 0x90 && msg.length == 3 && msg.data[2] != 0) {
+            // note on, goes to a single card
+            uint key = msg.data[1];
+            uint card = opl3_allocate_card(cards, channel, key);
+            cards.notecard[channel][key] = card;
+            opl3_send(cards.opl[card], word, frame);
+        }
         else {
-            uint32_t word = 0;
-            for (uint i = 0; i < msg.length; ++i)
-                word |= msg.data[i] << (8*i);
-            opl.WriteMidiData(word);
+            // everything else is shared, and note off is ignored by
+            // the cards which do not play the note
+            if ((status == 0x80 || status == 0x90) && msg.length == 3)
+                cards.notecard[channel][msg.data[1]] = opl3_nocard;
+            for (uint card = 0; card < numcards; ++card)
+                opl3_send(cards.opl[card], word, frame);
+        }
+    }
+}
+
+// save or recall the state of all cards
+static void opl3_apply_slot(t_opl3 *x, uint slot, bool restore, int frame)
+{
+    const uint numcards = x->x_cards.count;
+    opl3_cards &cards = x->x_cards;
+    opl3_saved &saved = x->x_slots[slot];
+
+    for (uint card = 0; card < numcards; ++card) {
+        OPLSynth &opl = cards.opl[card];
+        if (frame >= 0 && opl.QueueSnapshot(slot, restore, frame))
+            continue;
+        if (restore)
+            opl.RestoreSnapshot(slot);
+        else
+            opl.SaveSnapshot(slot);
+    }
+
+    // the routing goes with the messages, ahead of the audio
+    if (restore) {
+        cards.next = saved.next;
+        std::memcpy(cards.notecard, saved.notecard, sizeof(cards.notecard));
+    }
+    else {
+        saved.next = cards.next;
+        std::memcpy(saved.notecard, cards.notecard, sizeof(cards.notecard));
+    }
+}
+
+static void opl3_apply_event(t_opl3 *x, u32 data, int frame)
+{
+    const u32 kind = data & EVENT_KIND;
+    if (kind == EVENT_SNAPSHOT || kind == EVENT_RESTORE) {
+        opl3_apply_slot(x, data & ~EVENT_KIND, kind == EVENT_RESTORE, frame);
+        return;
+    }
+    u8 bytes[3];
+    for (uint i = 0; i < 3; ++i)
+        bytes[i] = data >> (8*i);
+    MIDI_Message msg;
+    msg.data = bytes;
+    msg.length = midi_message_sizeof(bytes[0]);
+    opl3_dispatch(x->x_cards, msg, frame);
+}
+
+// exclusive access to the cards, which the worker may be rendering
+static std::unique_lock<std::mutex> opl3_lock(t_opl3 *x)
+{
+    if (!x->x_ahead)
+        return std::unique_lock<std::mutex>();
+    return std::unique_lock<std::mutex>(x->x_ahead->mutex);
+}
+
+// apply an event at a frame of the next block, or forward it to the worker
+static void opl3_post(t_opl3 *x, u32 data, uint frame)
+{
+    opl3_ahead *a = x->x_ahead.get();
+    if (!a) {
+        opl3_apply_event(x, data, frame);
+        return;
+    }
+
+    // the output rendered from now is heard after the latency
+    opl3_event ev;
+    ev.time = a->reads + frame;
+    ev.data = data;
+    if (a->events.push(ev))
+        return;
+
+    // full, apply at once
+    std::lock_guard<std::mutex> lock(a->mutex);
+    opl3_apply_event(x, data, -1);
+}
+
+// apply a sysex at a frame of the next block, or forward it to the worker
+static void opl3_post_sysex(t_opl3 *x, const MIDI_Message &msg, uint frame)
+{
+    opl3_ahead *a = x->x_ahead.get();
+    if (!a) {
+        opl3_dispatch(x->x_cards, msg, frame);
+        return;
+    }
+
+    // the contents first, which the worker reads when it gets the event
+    if (!a->events.full() && a->sysex.write(msg.data, msg.length)) {
+        opl3_event ev;
+        ev.time = a->reads + frame;
+        ev.data = opl3_event_sysex | msg.length;
+        a->events.push(ev);
+        return;
+    }
+
+    // full, apply at once
+    std::lock_guard<std::mutex> lock(a->mutex);
+    opl3_dispatch(x->x_cards, msg, -1);
+}
+
+static void opl3_byte(t_opl3 *x, uint byte, uint frame)
+{
+    const MIDI_Message msg = x->x_midiparse.process(byte);
+    if (!msg)
+        return;
+
+    if (msg.data[0] == 0xf0) {
+        opl3_post_sysex(x, msg, frame);
+        return;
+    }
+
+    u32 word = 0;
+    for (uint i = 0; i < msg.length; ++i)
+        word |= msg.data[i] << (8*i);
+    opl3_post(x, word, frame);
+}
+
+static void opl3_midi(t_opl3 *x, t_float f)
+{
+    opl3_byte(x, (int)f, opl3_frame(x));
+}
+
+static void opl3_list(t_opl3 *x, t_symbol *, int argc, t_atom *argv)
+{
+    // a sequence of complete events, all at the same time
+    uint frame = opl3_frame(x);
+    for (int i = 0; i < argc; ++i)
+        opl3_byte(x, (int)atom_getfloat(&argv[i]), frame);
+}
+
+static void opl3_quality(t_opl3 *x, t_float f)
+{
+    const uint numcards = x->x_cards.count;
+    int quality = (int)f;
+    if (quality < 0 || quality >= RSM_QUALITY_COUNT) {
+        error("quality: must be between 0 and %d", RSM_QUALITY_COUNT - 1);
+        return;
+    }
+    try {
+        auto lock = opl3_lock(x);
+        for (uint card = 0; card < numcards; ++card)
+            x->x_cards.opl[card].SetQuality(quality);
+        x->x_quality = quality;
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+    }
+}
+
+static void opl3_pitchperiod(t_opl3 *x, t_float f)
+{
+    const uint numcards = x->x_cards.count;
+    int period = (int)f;
+    if (period < 1 || period > PITCH_PERIOD_MAX) {
+        error("pitchperiod: must be between 1 and %d", PITCH_PERIOD_MAX);
+        return;
+    }
+    auto lock = opl3_lock(x);
+    for (uint card = 0; card < numcards; ++card)
+        x->x_cards.opl[card].SetPitchPeriod(period);
+    x->x_pitchperiod = period;
+}
+
+// save or recall the state of all cards, at the time of the message
+static void opl3_slot_event(t_opl3 *x, t_float f, bool restore)
+{
+    int slot = (int)f;
+    if (slot < 0 || (uint)slot >= opl3_numslots) {
+        error("%s: slot must be between 0 and %u",
+              restore ? "restore" : "snapshot", opl3_numslots - 1);
+        return;
+    }
+
+    opl3_saved &saved = x->x_slots[slot];
+    if (restore && !saved.valid) {
+        error("restore: slot %d is empty", slot);
+        return;
+    }
+    saved.valid = true;
+
+    opl3_post(x, (restore ? EVENT_RESTORE : EVENT_SNAPSHOT) | slot, opl3_frame(x));
+}
+
+static void opl3_snapshot(t_opl3 *x, t_float f)
+{
+    opl3_slot_event(x, f, false);
+}
+
+static void opl3_restore(t_opl3 *x, t_float f)
+{
+    opl3_slot_event(x, f, true);
+}
+
+// find a file to read in the paths of the canvas
+static bool opl3_find_file(t_opl3 *x, t_symbol *file, std::string &path)
+{
+    char dir[MAXPDSTRING];
+    char *name = nullptr;
+    int fd = canvas_open(
+        x->x_canvas, file->s_name, "", dir, &name, MAXPDSTRING, 1);
+    if (fd < 0)
+        return false;
+    sys_close(fd);
+    path = std::string(dir) + '/' + name;
+    return true;
+}
+
+static void opl3_bank(t_opl3 *x, t_symbol *file)
+{
+    const uint numcards = x->x_cards.count;
+    std::shared_ptr<const OPLBank> bank;
+
+    // without a file, the default instruments
+    if (file != &s_) {
+        std::string path;
+        if (!opl3_find_file(x, file, path)) {
+            error("bank: %s: cannot open", file->s_name);
+            return;
+        }
+        try {
+            bank = OPLBank_Load(path.c_str());
+        }
+        catch (std::exception &ex) {
+            error("bank: %s: %s", file->s_name, ex.what());
+            return;
+        }
+    }
+
+    auto lock = opl3_lock(x);
+    for (uint card = 0; card < numcards; ++card)
+        x->x_cards.opl[card].SetBank(bank.get());
+    x->x_bank = std::move(bank);
+}
+
+//------------------------------------------------------------------------------
+// move the writes out of the rings, on the side of Pd
+static void opl3_capture_drain(t_opl3 *x)
+{
+    const uint numcards = x->x_cards.count;
+
+    for (uint card = 0; card < numcards; ++card) {
+        spsc_queue<RegWrite> &ring = x->x_capturering[card].ring;
+        std::vector<RegWrite> &log = x->x_capturelog[card];
+        for (const RegWrite *wr; (wr = ring.front()); ring.pop())
+            log.push_back(*wr);
+    }
+}
+
+static void opl3_capture_finish(t_opl3 *x)
+{
+    const uint numcards = x->x_cards.count;
+    const u64 rate = x->x_rate;
+
+    clock_unset(x->x_captureclock.get());
+
+    std::vector<RegWrite> log[2];
+    u64 capturelength;
+    bool overflow = false;
+    {
+        auto lock = opl3_lock(x);
+        for (uint card = 0; card < numcards; ++card) {
+            x->x_cards.opl[card].SetCapture(nullptr);
+            overflow |= x->x_capturering[card].bOverflow.load();
+        }
+        capturelength = x->x_capturelength;
+        x->x_capturing = false;
+    }
+    if (overflow)
+        error("capture: too many chip writes, the log stopped early");
+
+    try {
+        opl3_capture_drain(x);
+    }
+    catch (std::exception &ex) {
+        error("capture: %s", ex.what());
+    }
+    for (uint card = 0; card < numcards; ++card)
+        log[card].swap(x->x_capturelog[card]);
+
+    try {
+        // merge the cards in the time base of the format
+        std::vector<VGM_Write> writes;
+        writes.reserve(log[0].size() + log[1].size());
+        for (uint card = 0; card < numcards; ++card) {
+            for (const RegWrite &rw : log[card]) {
+                VGM_Write wr;
+                wr.time = (rw.dwSample * vgm_rate + rate / 2) / rate;
+                wr.chip = card;
+                wr.reg = rw.wReg;
+                wr.val = rw.bVal;
+                writes.push_back(wr);
+            }
+        }
+        std::stable_sort(
+            writes.begin(), writes.end(),
+            [](const VGM_Write &a, const VGM_Write &b) { return a.time < b.time; });
+
+        u32 length = (capturelength * vgm_rate + rate / 2) / rate;
+        vgm_save(x->x_capturepath.c_str(), writes.data(), writes.size(),
+                 length, numcards);
+    }
+    catch (std::exception &ex) {
+        error("capture: %s", ex.what());
+    }
+}
+
+static void opl3_capture(t_opl3 *x, t_symbol *file)
+{
+    const uint numcards = x->x_cards.count;
+
+    // without a file, the capture ends and is saved
+    if (file == &s_) {
+        if (!x->x_capturing)
+            error("capture: not started");
+        else
+            opl3_capture_finish(x);
+        return;
+    }
+
+    if (numcards > 2) {
+        error("capture: at most 2 chips can go to a file");
+        return;
+    }
+    if (x->x_capturing)
+        opl3_capture_finish(x);
+
+    char path[MAXPDSTRING];
+    canvas_makefilename(x->x_canvas, file->s_name, path, MAXPDSTRING);
+
+    auto lock = opl3_lock(x);
+    try {
+        x->x_capturepath = path;
+        for (uint card = 0; card < numcards; ++card) {
+            x->x_capturering[card].ring.reset(opl3_capturering);
+            x->x_capturering[card].bOverflow = false;
+            x->x_capturelog[card].clear();
+        }
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        return;
+    }
+
+    x->x_capturelength = 0;
+    x->x_capturing = true;
+    for (uint card = 0; card < numcards; ++card)
+        x->x_cards.opl[card].SetCapture(&x->x_capturering[card]);
+    clock_delay(x->x_captureclock.get(), opl3_capturepoll);
+}
+
+static void opl3_capture_tick(t_opl3 *x)
+{
+    const uint numcards = x->x_cards.count;
+
+    // the log stopped, the capture ends at once
+    bool overflow = false;
+    for (uint card = 0; card < numcards; ++card)
+        overflow |= x->x_capturering[card].bOverflow.load();
+    if (overflow) {
+        opl3_capture_finish(x);
+        return;
+    }
+
+    try {
+        opl3_capture_drain(x);
+    }
+    catch (std::exception &ex) {
+        error("capture: %s", ex.what());
+        opl3_capture_finish(x);
+        return;
+    }
+    clock_delay(x->x_captureclock.get(), opl3_capturepoll);
+}
+
+static void opl3_play(t_opl3 *x, t_symbol *file)
+{
+    // without a file, the playback stops
+    if (file == &s_) {
+        auto lock = opl3_lock(x);
+        x->x_player.reset();
+        return;
+    }
+
+    std::string path;
+    if (!opl3_find_file(x, file, path)) {
+        error("play: %s: cannot open", file->s_name);
+        return;
+    }
+
+    try {
+        std::unique_ptr<opl3_player> pl(new opl3_player);
+        pl->stream.open(path.c_str());
+        pl->rate = x->x_rate;
+        // the writes to a chip without a card are dropped
+        if (pl->stream.chips() > x->x_cards.count)
+            error("play: %s: %u chips in the file, the writes to the chips "
+                  "past %u are ignored", file->s_name, pl->stream.chips(),
+                  x->x_cards.count);
+        auto lock = opl3_lock(x);
+        x->x_player = std::move(pl);
+    }
+    catch (std::exception &ex) {
+        error("play: %s: %s", file->s_name, ex.what());
+    }
+}
+
+//------------------------------------------------------------------------------
+// apply an event which was forwarded to the worker
+static void opl3_ahead_apply(t_opl3 *x, opl3_ahead *a, u32 data, int frame)
+{
+    if ((data & EVENT_KIND) != opl3_event_sysex) {
+        opl3_apply_event(x, data, frame);
+        return;
+    }
+    MIDI_Message msg;
+    msg.data = a->sysexbuf.get();
+    msg.length = data & ~EVENT_KIND;
+    a->sysex.read(a->sysexbuf.get(), msg.length);
+    opl3_dispatch(x->x_cards, msg, frame);
+}
+
+void opl3_ahead::join()
+{
+    if (!thread.joinable())
+        return;
+    quit = true;
+    {
+        std::lock_guard<std::mutex> lock(wakemutex);
+        wake.notify_one();
+    }
+    thread.join();
+}
+
+static void opl3_ahead_run(t_opl3 *x, opl3_ahead *a)
+{
+    const uint n = a->blocksize;
+    const uint capacity = 2 * n * a->blocks;
+    const std::chrono::microseconds period((u64)n * 1000000 / x->x_rate);
+    t_float *left = a->buffer.get();
+    t_float *right = left + n;
+
+    while (!a->quit) {
+        // wait until the output has room for another block
+        if (a->ring.read_space() + 2 * n > capacity) {
+            std::unique_lock<std::mutex> lock(a->wakemutex);
+            a->wake.wait_for(lock, period);
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(a->mutex);
+            const u64 start = a->position;
+            while (const opl3_event *ev = a->events.front()) {
+                if (ev->time >= start + n)
+                    break;
+                uint frame = (ev->time > start) ? (ev->time - start) : 0;
+                opl3_ahead_apply(x, a, ev->data, frame);
+                a->events.pop();
+            }
+            opl3_process(x, n, left, right);
+        }
+
+        a->ring.write(left, 2 * n);
+        a->position += n;
+    }
+}
+
+static void opl3_ahead_start(t_opl3 *x)
+{
+    const uint n = x->x_blocksize;
+    const uint blocks = x->x_lookahead;
+    if (n == 0 || blocks == 0)
+        return;
+
+    try {
+        std::unique_ptr<opl3_ahead> a(new opl3_ahead);
+        a->blocksize = n;
+        a->blocks = blocks;
+        a->ring.reset(2 * n * blocks);
+        a->buffer.reset(new t_float[2 * n]());
+        a->events.reset(opl3_aheadevents);
+        a->sysex.reset(opl3_aheadsysex);
+        a->sysexbuf.reset(new u8[opl3_maxsysex]);
+        // the latency, which the worker fills in advance
+        for (uint i = 0; i < blocks; ++i)
+            a->ring.write(a->buffer.get(), 2 * n);
+        a->thread = std::thread(&opl3_ahead_run, x, a.get());
+        x->x_ahead = std::move(a);
+    }
+    catch (std::exception &ex) {
+        error("lookahead: %s", ex.what());
+    }
+}
+
+static void opl3_ahead_stop(t_opl3 *x)
+{
+    std::unique_ptr<opl3_ahead> a = std::move(x->x_ahead);
+    if (!a)
+        return;
+    a->join();
+
+    // the events not rendered yet, at once
+    while (const opl3_event *ev = a->events.front()) {
+        opl3_ahead_apply(x, a.get(), ev->data, -1);
+        a->events.pop();
+    }
+}
+
+static void opl3_latency_tick(t_opl3 *x)
+{
+    const opl3_ahead *a = x->x_ahead.get();
+    t_float latency = 0;
+    if (a)
+        latency = 1e3 * a->blocksize * a->blocks / x->x_rate;
+    t_atom msg;
+    SETFLOAT(&msg, latency);
+    outlet_anything(x->x_otl_done.get(), gensym("latency"), 1, &msg);
+}
+
+static void opl3_lookahead(t_opl3 *x, t_float f)
+{
+    int blocks = (int)f;
+    if (blocks < 0 || (uint)blocks > opl3_maxlookahead) {
+        error("lookahead: must be between 0 and %u", opl3_maxlookahead);
+        return;
+    }
+    opl3_ahead_stop(x);
+    x->x_lookahead = blocks;
+    opl3_ahead_start(x);
+    clock_delay(x->x_latencyclock.get(), 0);
+}
+
+//------------------------------------------------------------------------------
+opl3_offline::~opl3_offline()
+{
+    cancel = true;
+    if (thread.joinable())
+        thread.join();
+}
+
+// generate a block of all the cards mixed, sequentially
+static void opl3_generate(
+    opl3_cards &cards, t_float *left, t_float *right, uint n, t_float *scratch)
+{
+    cards.opl[0].GetSample(left, right, n);
+    for (uint card = 1; card < cards.count; ++card) {
+        t_float *cardleft = scratch, *cardright = scratch + n;
+        cards.opl[card].GetSample(cardleft, cardright, n);
+#pragma omp simd
+        for (uint i = 0; i < n; ++i) {
+            left[i] += cardleft[i];
+            right[i] += cardright[i];
+        }
+    }
+}
+
+static bool opl3_idle(const opl3_cards &cards)
+{
+    for (uint card = 0; card < cards.count; ++card)
+        if (!cards.opl[card].Opl3_IsIdle())
+            return false;
+    return true;
+}
+
+static void opl3_offline_run(opl3_offline *r)
+{
+    try {
+        SMF_File smf;
+        smf.load(r->path.c_str());
+
+        // cards of its own, like those of the object
+        opl3_cards cards;
+        opl3_cards_init(cards, r->numcards, r->rate);
+        for (uint card = 0; card < cards.count; ++card) {
+            cards.opl[card].SetQuality(r->quality);
+            cards.opl[card].SetPitchPeriod(r->pitchperiod);
+            cards.opl[card].SetBank(r->bank.get());
+        }
+
+        const uint rate = r->rate;
+        const uint blocksize = 64;
+        std::unique_ptr<t_float[]> scratch(new t_float[2 * blocksize]);
+        std::vector<t_float> &left = r->left;
+        std::vector<t_float> &right = r->right;
+        size_t pos = 0;
+
+        const size_t expected = (size_t)((smf.duration() + 1) * rate);
+        left.reserve(expected);
+        right.reserve(expected);
+
+        auto render = [&](size_t end) {
+            while (pos < end && !r->cancel) {
+                uint n = std::min<size_t>(end - pos, blocksize);
+                left.resize(pos + n);
+                right.resize(pos + n);
+                opl3_generate(cards, &left[pos], &right[pos], n, scratch.get());
+                pos += n;
+            }
+        };
+
+        // the events at their exact sample positions
+        for (const SMF_Event &ev : smf.events()) {
+            render((size_t)(ev.time * rate + 0.5));
+            MIDI_Message msg;
+            msg.data = smf.data(ev);
+            msg.length = ev.length;
+            opl3_dispatch(cards, msg, -1);
         }
+
+        // then the release of the last notes
+        const size_t tailend = pos + (size_t)(opl3_rendertail * rate);
+        while (pos < tailend && !r->cancel && !opl3_idle(cards))
+            render(std::min<size_t>(pos + blocksize, tailend));
+    }
+    catch (std::exception &ex) {
+        r->error = ex.what();
+    }
+
+    r->done = true;
+}
+
+static void opl3_offline_tick(t_opl3 *x)
+{
+    opl3_offline *r = x->x_render.get();
+    if (!r)
+        return;
+    if (!r->done) {
+        clock_delay(x->x_renderclock.get(), opl3_renderpoll);
+        return;
+    }
+
+    std::unique_ptr<opl3_offline> finished = std::move(x->x_render);
+    r->thread.join();
+
+    if (!r->error.empty()) {
+        error("render: %s", r->error.c_str());
+        return;
+    }
+
+    const size_t length = r->left.size();
+    t_symbol *arraynames[2] = {r->leftarray, r->rightarray};
+    const t_float *channels[2] = {r->left.data(), r->right.data()};
+
+    for (uint c = 0; c < 2; ++c) {
+        t_garray *array = (t_garray *)pd_findbyclass(arraynames[c], garray_class);
+        int size = 0;
+        t_word *vec = nullptr;
+        if (!array) {
+            error("render: %s: no such array", arraynames[c]->s_name);
+            continue;
+        }
+        garray_resize_long(array, length);
+        if (!garray_getfloatwords(array, &size, &vec)) {
+            error("render: %s: bad template for opl3~", arraynames[c]->s_name);
+            continue;
+        }
+        const t_float *data = channels[c];
+        for (size_t i = 0, n = std::min<size_t>(size, length); i < n; ++i)
+            vec[i].w_float = data[i];
+        garray_redraw(array);
     }
+
+    outlet_float(x->x_otl_done.get(), length);
+}
+
+static void opl3_render(
+    t_opl3 *x, t_symbol *file, t_symbol *leftarray, t_symbol *rightarray)
+{
+    if (x->x_render) {
+        error("render: already in progress");
+        return;
+    }
+
+    std::string path;
+    if (!opl3_find_file(x, file, path)) {
+        error("render: %s: cannot open", file->s_name);
+        return;
+    }
+
+    try {
+        std::unique_ptr<opl3_offline> r(new opl3_offline);
+        r->path = std::move(path);
+        r->leftarray = leftarray;
+        r->rightarray = rightarray;
+        r->rate = x->x_rate;
+        r->numcards = x->x_cards.count;
+        r->quality = x->x_quality;
+        r->pitchperiod = x->x_pitchperiod;
+        r->bank = x->x_bank;
+        r->thread = std::thread(&opl3_offline_run, r.get());
+        x->x_render = std::move(r);
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        return;
+    }
+
+    clock_delay(x->x_renderclock.get(), opl3_renderpoll);
 }
 
 PDEX_API
@@ -92,4 +1145,25 @@ void opl3_tilde_setup()
         cls, (t_method)&opl3_dsp, gensym("dsp"), A_CANT, A_NULL);
     class_addmethod(
         cls, (t_method)&opl3_midi, &s_float, A_FLOAT, A_NULL);
+    class_addlist(
+        cls, (t_method)&opl3_list);
+    class_addmethod(
+        cls, (t_method)&opl3_quality, gensym("quality"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_pitchperiod, gensym("pitchperiod"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_render, gensym("render"),
+        A_SYMBOL, A_SYMBOL, A_SYMBOL, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_bank, gensym("bank"), A_DEFSYMBOL, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_snapshot, gensym("snapshot"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_restore, gensym("restore"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_capture, gensym("capture"), A_DEFSYMBOL, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_play, gensym("play"), A_DEFSYMBOL, A_NULL);
+    class_addmethod(
+        cls, (t_method)&opl3_lookahead, gensym("lookahead"), A_FLOAT, A_NULL);
 }
@@ -33,22 +33,27 @@
 //     filter computations for any sample rate
 //     5th order Butterworth as anti-aliasing filter
 //     bilinear transform instead of MATLAB's invfreqz
+//     antiderivative antialiasing of the waveshaper, as an option
+//     oversampling, as an option, the filters designed for the higher rate
 
 #include "util/pd++.h"
 #include "util/filter/design.h"
 #include "util/dsp.h"
+#include "util/dsp/adaa.h"
+#include "util/dsp/oversampler.h"
 #include <jsl/dynarray>
 #include <jsl/math>
 #include <jsl/types>
+#include <algorithm>
+#include <limits>
 
 struct t_bbd : pd_basic_object<t_bbd> {
     t_float x_signalin = 0;
     t_float x_maxdelay = 0;
-    iir_t<f64> x_aaflt;
-    iir_t<f64> x_r1flt;
-    iir_t<f64> x_r2flt;
-    iir_t<f64> x_compflt;
-    iir_t<f64> x_expdflt;
+    iir_sos_t<f64> x_aaflt;
+    iir_sos_t<f64> x_recflt;
+    iir_sos_t<f64> x_compflt;
+    iir_sos_t<f64> x_expdflt;
     pd_dynarray<t_float> x_stages;
     uint x_istage = 0;
     t_float x_regen = 0.02;
@@ -58,11 +63,83 @@ struct t_bbd : pd_basic_object<t_bbd> {
     t_float x_previnval = 0;
     t_float x_currtime = 0;
     u32 x_rndseed = 0;
+    clipped_cubic<f64> x_shape;
+    adaa<f64> x_adaa;
+    oversampler<t_float, 8> x_os;
+    uint x_osfactor = 1;
+    oversampler_mode x_osmode = oversampler_linear;
+    uint x_blocksize = 0;
+    pd_dynarray<t_float> x_delbuf;
+    pd_dynarray<f64> x_inbuf;
+    pd_dynarray<f64> x_outbuf;
+    pd_dynarray<int> x_tickidx;
+    pd_dynarray<t_float> x_tickfrac;
     u_inlet x_inl_delay;
     u_outlet x_otl_output;
+    u_outlet x_otl_info;
 };
 
 static constexpr t_float bbd_mindelay = 1e-5_f;
+// Waveshaping nonlinearity
+static constexpr t_float bbd_shape[] = {1.0/16, 1.0, -1.0/166, -1.0/32};
+
+// design the filters for the given rate
+static void bbd_design(t_bbd *x, t_float fs)
+{
+    const uint nstages = x->x_stages.size();
+    const t_float maxclockrate = nstages / (2 * x->x_maxdelay);
+
+    // anti aliasing filter
+    {
+        pzk_t<f64> aapzk = iir_lowpass<f64>(
+            iir_butterworth<f64>(5), 0.5 * maxclockrate / fs);
+        x->x_aaflt = iir_sos_t<f64>(aapzk);
+    }
+    // reconstruction filters 1 and 2, in cascade
+    {
+        pzk_t<f64> r1pzk, r2pzk;
+        {
+            f64 R = 10e3, C1 = .0022e-6, C2 = .033e-6, C3 = .001e-6;
+            coef_t<f64> analog;
+            analog.b = { 1 };
+            analog.a = { R*R*R*C1*C2*C3, R*R*2*C1*C3 + R*R*2*C2*C3, R*C1+R*C3, 1 };
+            r1pzk = iir_pzk_bilinear(analog.pzk(), (f64)fs);
+        }
+        {
+            f64 R = 10e3, C1 = .039e-6, C2 = .00033e-6;
+            coef_t<f64> analog;
+            analog.b = { 1 };
+            analog.a = { R*R*C1*C2, 2*R*C2, 1 };
+            r2pzk = iir_pzk_bilinear(analog.pzk(), (f64)fs);
+        }
+        uint np1 = r1pzk.p.size(), np2 = r2pzk.p.size();
+        uint nz1 = r1pzk.z.size(), nz2 = r2pzk.z.size();
+        pzk_t<f64> recpzk;
+        recpzk.p.reset(np1 + np2);
+        recpzk.z.reset(nz1 + nz2);
+        std::copy(r1pzk.p.begin(), r1pzk.p.end(), &recpzk.p[0]);
+        std::copy(r2pzk.p.begin(), r2pzk.p.end(), &recpzk.p[np1]);
+        std::copy(r1pzk.z.begin(), r1pzk.z.end(), &recpzk.z[0]);
+        std::copy(r2pzk.z.begin(), r2pzk.z.end(), &recpzk.z[nz1]);
+        recpzk.k = r1pzk.k * r2pzk.k;
+        x->x_recflt = iir_sos_t<f64>(recpzk);
+    }
+    // averager
+    {
+        f64 C = .82e-6;
+        f64 smoothing = (1/fs) / (10000 * C + (1/fs));
+        coef_t<f64> avgcoef;
+        avgcoef.b = { smoothing, 0 };
+        avgcoef.a = { 1, -1 + smoothing };
+        x->x_compflt = iir_sos_t<f64>(avgcoef);
+        x->x_expdflt = iir_sos_t<f64>(avgcoef);
+    }
+    // waveshaper, which does not clip
+    {
+        const f64 coef[4] = {bbd_shape[0], bbd_shape[1], bbd_shape[2], bbd_shape[3]};
+        x->x_shape.set(coef, std::numeric_limits<f64>::infinity());
+    }
+}
 
 static void *bbd_new(t_symbol *s, int argc, t_atom argv[])
 {
@@ -84,53 +161,23 @@ static void *bbd_new(t_symbol *s, int argc, t_atom argv[])
         default: return nullptr;
         }
 
-        if (maxdelay < bbd_mindelay || (int)nstages < 0)
+        if (maxdelay < bbd_mindelay || (int)nstages < 1)
             return nullptr;
 
         ///
         x->x_maxdelay = maxdelay;
         x->x_stages.reset(nstages);
 
-        t_float maxclockrate = nstages / (2 * maxdelay);
+        bbd_design(x.get(), fs);
 
-        // anti aliasing filter
-        {
-            pzk_t<f64> pzk = iir_lowpass<f64>(
-                iir_butterworth<f64>(5), 0.5 * maxclockrate / fs);
-            coef_t<f64> aacoef = pzk.coefs();
-            x->x_aaflt = iir_t<f64>(aacoef);
-        }
-        // reconstruction filter 1
-        {
-            f64 R = 10e3, C1 = .0022e-6, C2 = .033e-6, C3 = .001e-6;
-            coef_t<f64> analog;
-            analog.b = { 1 };
-            analog.a = { R*R*R*C1*C2*C3, R*R*2*C1*C3 + R*R*2*C2*C3, R*C1+R*C3, 1 };
-            coef_t<f64> r1coef = bilinear(analog, (f64)fs);
-            x->x_r1flt = iir_t<f64>(r1coef);
-        }
-        // reconstruction filter 2
-        {
-            f64 R = 10e3, C1 = .039e-6, C2 = .00033e-6;
-            coef_t<f64> analog;
-            analog.b = { 1 };
-            analog.a = { R*R*C1*C2, 2*R*C2, 1 };
-            coef_t<f64> r2coef = bilinear(analog, (f64)fs);
-            x->x_r2flt = iir_t<f64>(r2coef);
-        }
-        // averager
-        {
-            f64 C = .82e-6;
-            f64 smoothing = (1/fs) / (10000 * C + (1/fs));
-            coef_t<f64> avgcoef;
-            avgcoef.b = { smoothing, 0 };
-            avgcoef.a = { 1, -1 + smoothing };
-            x->x_compflt = iir_t<f64>(avgcoef);
-            x->x_expdflt = iir_t<f64>(avgcoef);
-        }
+        // for the usual block, until the DSP is started
+        x->x_blocksize = 64;
+        x->x_os = oversampler<t_float, 8>(x->x_osmode, x->x_blocksize);
+        x->x_os.factor(x->x_osfactor);
 
         x->x_inl_delay.reset(inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal));
         x->x_otl_output.reset(outlet_new(&x->x_obj, &s_signal));
+        x->x_otl_info.reset(outlet_new(&x->x_obj, nullptr));
     }
     catch (std::exception &ex) {
         error("%s", ex.what());
@@ -140,17 +187,16 @@ static void *bbd_new(t_symbol *s, int argc, t_atom argv[])
     return x.release();
 }
 
-static void bbd_perform(
-    t_bbd *x, const uint n,
+// process a number of samples not exceeding the number of stages, such that
+// all the stages read in this call precede those which are written
+static void bbd_process(
+    t_bbd *x, const uint n, const t_float fs,
     const t_sample *in, const t_sample *del, t_sample *out)
 {
-    t_float fs = sys_getsr();
-
-    iir_t<f64> &aaflt = x->x_aaflt;
-    iir_t<f64> &r1flt = x->x_r1flt;
-    iir_t<f64> &r2flt = x->x_r2flt;
-    iir_t<f64> &compflt = x->x_compflt;
-    iir_t<f64> &expdflt = x->x_expdflt;
+    iir_sos_t<f64> &aaflt = x->x_aaflt;
+    iir_sos_t<f64> &recflt = x->x_recflt;
+    iir_sos_t<f64> &compflt = x->x_compflt;
+    iir_sos_t<f64> &expdflt = x->x_expdflt;
 
     t_float *stages = x->x_stages.data();
     const uint nstages = x->x_stages.size();
@@ -164,7 +210,16 @@ static void bbd_perform(
     t_float previnval = x->x_previnval;
     t_float currtime = x->x_currtime;
     u32 rndseed = x->x_rndseed;
+    const clipped_cubic<f64> &shape = x->x_shape;
+    adaa<f64> &aa = x->x_adaa;
+    const bool antialias = aa.order() > 0;
+
+    f64 *inbuf = x->x_inbuf.data();
+    f64 *outbuf = x->x_outbuf.data();
+    int *tickidx = x->x_tickidx.data();
+    t_float *tickfrac = x->x_tickfrac.data();
 
+    // Clock the stages, get out values
     for (uint i = 0; i < n; ++i) {
         t_float delay = jsl::clamp(del[i], bbd_mindelay, maxdelay);
 
@@ -172,44 +227,69 @@ static void bbd_perform(
         clockrate = (clockrate > fs) ? fs : clockrate;
         t_float clockdelta = clockrate / fs;
 
-        // Compress
-        t_float bbdin = (0.5_f * in[i] + prevbbdout) /
-            ((t_float)compflt.tick(std::fabs(prevcompout)) + 1e-5_f);
-        // Remember compressor output
-        prevcompout = bbdin;
-        // Anti-aliasing filter
-        bbdin = aaflt.tick(bbdin);
-        // Sampled input/output
+        int tick = -1;
         if (currtime >= 1) {
-            // Tick in linearly interpolated value, get out value
-            t_float delta = currtime - 1;
-            t_float delayin = delta * bbdin + (1 - delta) * previnval;
+            // Remember where to tick in the value, get out value
+            tick = istage;
+            tickfrac[i] = currtime - 1;
             bbdout = stages[istage];
-            stages[istage] = delayin;
             istage = (istage + 1) % nstages;
             // Decrement time
             currtime -= 1;
         }
+        tickidx[i] = tick;
 
-        // Waveshaping nonlinearity
-        constexpr t_float poly[] = {1.0/16, 1.0, -1.0/166, -1.0/32};
-        bbdout = jsl::polyval<t_float>(poly, bbdout);
+        // Waveshaping nonlinearity, sample by sample since a value held
+        // between ticks is shaped again
+        if (antialias)
+            bbdout = aa.process(shape, (f64)bbdout);
+        else
+            bbdout = jsl::polyval<t_float>(bbd_shape, bbdout);
 
         // Add in -60 dB noise
         bbdout += 1e-3_f * white<t_float>(&rndseed);
 
-        // Reconstruction filters
-        t_float recout = r1flt.tick(bbdout);
-        recout = r2flt.tick(recout);
-        // Expand
-        recout *= (t_float)expdflt.tick(std::fabs(recout));
+        outbuf[i] = bbdout;
+        currtime += clockdelta;
+    }
+
+    // Reconstruction filters
+    recflt.process(outbuf, outbuf, n);
+    // Expand
+    for (uint i = 0; i < n; ++i)
+        inbuf[i] = std::fabs((t_float)outbuf[i]);
+    expdflt.process(inbuf, inbuf, n);
+    for (uint i = 0; i < n; ++i)
+        outbuf[i] = (t_float)outbuf[i] * (t_float)inbuf[i];
+
+    for (uint i = 0; i < n; ++i) {
+        // Compress
+        t_float bbdin = (0.5_f * in[i] + prevbbdout) /
+            ((t_float)compflt.tick(std::fabs(prevcompout)) + 1e-5_f);
+        // Remember compressor output
+        prevcompout = bbdin;
+        inbuf[i] = bbdin;
+        prevbbdout = regen * (t_float)outbuf[i];
+    }
+
+    // Anti-aliasing filter
+    aaflt.process(inbuf, inbuf, n);
 
-        out[i] = recout;
-        prevbbdout = regen * recout;
+    // Sampled input
+    for (uint i = 0; i < n; ++i) {
+        t_float bbdin = inbuf[i];
+        int tick = tickidx[i];
+        if (tick != -1) {
+            // Tick in linearly interpolated value
+            t_float delta = tickfrac[i];
+            stages[tick] = delta * bbdin + (1 - delta) * previnval;
+        }
         previnval = bbdin;
-        currtime += clockdelta;
     }
 
+    for (uint i = 0; i < n; ++i)
+        out[i] = outbuf[i];
+
     x->x_istage = istage;
     x->x_prevcompout = prevcompout;
     x->x_bbdout = bbdout;
@@ -219,8 +299,61 @@ static void bbd_perform(
     x->x_rndseed = rndseed;
 }
 
+// process at the given rate
+static void bbd_run(
+    t_bbd *x, const uint n, const t_float fs,
+    const t_sample *in, const t_sample *del, t_sample *out)
+{
+    const uint nstages = x->x_stages.size();
+    const uint nchunk = (n < nstages) ? n : nstages;
+
+    for (uint i = 0; i < n; i += nchunk) {
+        uint nleft = n - i;
+        uint ncur = (nleft < nchunk) ? nleft : nchunk;
+        bbd_process(x, ncur, fs, in + i, del + i, out + i);
+    }
+}
+
+static void bbd_perform(
+    t_bbd *x, const uint n,
+    const t_sample *in, const t_sample *del, t_sample *out)
+{
+    const t_float fs = sys_getsr();
+
+    oversampler<t_float, 8> &os = x->x_os;
+    const uint factor = os.factor();
+    if (factor == 1) {
+        bbd_run(x, n, fs, in, del, out);
+        return;
+    }
+
+    // the delay held over the samples at the higher rate
+    t_float *delbuf = x->x_delbuf.data();
+    for (uint i = 0; i < n; ++i)
+        std::fill_n(&delbuf[i * factor], factor, del[i]);
+
+    t_float *buffer = os.up(in, n);
+    bbd_run(x, n * factor, fs * factor, buffer, delbuf, buffer);
+    os.down(out, n);
+}
+
 static void bbd_dsp(t_bbd *x, t_signal **sp)
 {
+    const uint n = sp[0]->s_n;
+    if (x->x_blocksize != n) {
+        x->x_os = oversampler<t_float, 8>(x->x_osmode, n);
+        x->x_os.factor(x->x_osfactor);
+        x->x_blocksize = n;
+    }
+    // buffers for the block at the highest rate
+    const uint nmax = n * 8;
+    if (x->x_outbuf.size() != nmax) {
+        x->x_inbuf.reset(nmax);
+        x->x_outbuf.reset(nmax);
+        x->x_tickidx.reset(nmax);
+        x->x_tickfrac.reset(nmax);
+        x->x_delbuf.reset(nmax);
+    }
     dsp_add_s(
         bbd_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec);
 }
@@ -230,6 +363,57 @@ static void bbd_regen(t_bbd *x, t_floatarg r)
     x->x_regen = r;
 }
 
+static void bbd_adaa(t_bbd *x, t_floatarg f)
+{
+    int order = (int)f;
+    if (order < 0 || order > 2) {
+        error("adaa: the order must be 0, 1 or 2");
+        return;
+    }
+    x->x_adaa.order(order);
+}
+
+static void bbd_oversample(t_bbd *x, t_symbol *, int argc, t_atom *argv)
+{
+    int factor = (argc > 0) ? (int)atom_getfloat(&argv[0]) : 1;
+    t_symbol *mode = (argc > 1) ? atom_getsymbol(&argv[1]) : gensym("linear");
+    if (argc > 2 || (factor != 1 && factor != 2 && factor != 4 && factor != 8)) {
+        error("oversample: the factor must be 1, 2, 4 or 8");
+        return;
+    }
+    if (mode != gensym("linear") && mode != gensym("minimum")) {
+        error("oversample: the mode must be linear or minimum");
+        return;
+    }
+
+    oversampler_mode osmode = (mode == gensym("linear")) ?
+        oversampler_linear : oversampler_minimum;
+    try {
+        if (x->x_os.mode() != osmode)
+            x->x_os = oversampler<t_float, 8>(osmode, x->x_blocksize);
+        bbd_design(x, sys_getsr() * factor);
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        return;
+    }
+    x->x_osfactor = factor;
+    x->x_osmode = osmode;
+    x->x_os.factor(factor);
+    x->x_adaa.reset();
+}
+
+// output the delay added by the oversampling and the antialiasing, in
+// milliseconds
+static void bbd_latency(t_bbd *x)
+{
+    const t_float fs = sys_getsr();
+    f64 latency = x->x_os.latency() + 0.5 * x->x_adaa.order() / x->x_osfactor;
+    t_atom msg;
+    SETFLOAT(&msg, 1e3 * latency / fs);
+    outlet_anything(x->x_otl_info.get(), gensym("latency"), 1, &msg);
+}
+
 PDEX_API
 void bbd_tilde_setup()
 {
@@ -243,4 +427,13 @@ void bbd_tilde_setup()
     class_addmethod(
         cls, (t_method)&bbd_regen, gensym("regen"),
         A_DEFFLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&bbd_adaa, gensym("adaa"),
+        A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&bbd_oversample, gensym("oversample"),
+        A_GIMME, A_NULL);
+    class_addmethod(
+        cls, (t_method)&bbd_latency, gensym("latency"),
+        A_NULL);
 }
@@ -3,21 +3,78 @@
  * Copyright (C) 2018 Jean-Pierre Cimalando.
  */
 
+// Implementation notes
+//     channels are linked, a single gain is computed from the highest peak
+//     of all channels, and applied to each of them after the delay
+//     the block is processed in passes: detection of the peaks per channel,
+//     computation of the gain, application of the gain per channel
+//     oversampling, as an option, the whole processing at the higher rate
+
 #include "util/pd++.h"
+#include "util/dsp/sliding_max.h"
+#include "util/dsp/true_peak.h"
+#include "util/dsp/oversampler.h"
 #include <jsl/dynarray>
 #include <jsl/math>
 #include <jsl/types>
+#include <algorithm>
+#include <cmath>
+
+// lookahead: the longest in milliseconds, and the time of release
+static constexpr t_float limit_maxlookahead = 50;
+static constexpr t_float limit_release = 50;
+static constexpr uint limit_maxchannels = 64;
+static constexpr uint limit_maxoversample = 8;
+// without lookahead: the delay of the signal, and the coefficients of attack
+// and release, for the base rate
+static constexpr uint limit_delay = 5;
+static constexpr t_float limit_attack = 0.3;
+static constexpr t_float limit_decay = 0.01;
 
+// in lookahead mode, the gain which brings the peaks of the window to the
+// threshold is held for the window, released by a one-pole, and smoothed by
+// a moving average over the window, so it reaches the value of a peak by a
+// ramp which ends just as the peak comes out of the delay.
 struct t_limit : pd_basic_object<t_limit> {
     t_float x_signalin = 0;
+    uint x_nchannels = 0;
     t_float x_lt = 1;
     t_float x_xpeak = 0;
     t_float x_g = 1;
-    uint x_delayidx = 0;
+    t_float x_at = limit_attack;
+    t_float x_rt = limit_decay;
+    // lookahead mode, if the length is not zero
+    t_float x_lookaheadms = 0;
+    uint x_lookahead = 0;
+    uint x_maxlookahead = 0;
+    bool x_truepeak = false;
+    t_float x_releasecoef = 0;
+    pd_dynarray<true_peak<t_float>> x_peak;
+    sliding_max<t_float> x_peakmax;
+    t_float x_release = 1;
+    // gains of the moving average, and their sum
+    pd_dynarray<t_float> x_gains;
+    uint x_gainidx = 0;
+    double x_gainsum = 0;
+    // delays of the channels, circular, each of the same power of 2
     pd_dynarray<t_float> x_delay;
-    u_outlet x_otl_output;
+    uint x_delaysize = 0;
+    uint x_delayidx = 0;
+    // peaks of the block, then gains
+    pd_dynarray<t_float> x_buffer;
+    // oversamplers of the channels
+    pd_dynarray<oversampler<t_float, limit_maxoversample>> x_os;
+    uint x_osfactor = 1;
+    oversampler_mode x_osmode = oversampler_linear;
+    uint x_blocksize = 0;
+    pd_dynarray<u_inlet> x_inl_input;
+    pd_dynarray<u_outlet> x_otl_output;
+    u_outlet x_otl_info;
 };
 
+static void limit_set_rate(t_limit *x);
+static void limit_set_lookahead(t_limit *x, t_float ms);
+
 static t_limit *limit_new(t_symbol *s, int argc, t_atom *argv)
 {
     u_pd<t_limit> x;
@@ -26,8 +83,12 @@ static t_limit *limit_new(t_symbol *s, int argc, t_atom *argv)
         x = pd_make_instance<t_limit>();
 
         t_float lt = 1;
+        t_float lookahead = 0;
+        int nchannels = 1;
 
         switch (argc) {
+        case 3: nchannels = (int)atom_getfloat(&argv[2]);  // fall through
+        case 2: lookahead = atom_getfloat(&argv[1]);  // fall through
         case 1: lt = atom_getfloat(&argv[0]);  // fall through
         case 0: break;
         default: return nullptr;
@@ -35,13 +96,45 @@ static t_limit *limit_new(t_symbol *s, int argc, t_atom *argv)
 
         if (lt < 0)
             return nullptr;
+        if (lookahead < 0 || lookahead > limit_maxlookahead) {
+            error("lookahead must be between 0 and %g ms", limit_maxlookahead);
+            return nullptr;
+        }
+        if (nchannels < 1 || (uint)nchannels > limit_maxchannels) {
+            error("channels must be between 1 and %u", limit_maxchannels);
+            return nullptr;
+        }
 
         x->x_lt = lt;
+        x->x_nchannels = nchannels;
+
+        // the memory of the longest lookahead at the highest rate,
+        // allocated in advance
+        const t_float fs = sys_getsr() * limit_maxoversample;
+        const uint maxlookahead = std::ceil(limit_maxlookahead * 1e-3_f * fs);
+        x->x_maxlookahead = std::max(maxlookahead, 1u);
+        x->x_peak.reset(nchannels);
+        x->x_peakmax = sliding_max<t_float>(x->x_maxlookahead);
+        x->x_gains.reset(x->x_maxlookahead);
+
+        // for the usual block, until the DSP is started
+        x->x_blocksize = 64;
+        x->x_os.reset(nchannels);
+        for (uint c = 0; c < (uint)nchannels; ++c) {
+            x->x_os[c] = oversampler<t_float, limit_maxoversample>(x->x_osmode, x->x_blocksize);
+            x->x_os[c].factor(x->x_osfactor);
+        }
 
-        const uint delay = 5;
-        x->x_delay.reset(delay);
+        limit_set_rate(x.get());
+        limit_set_lookahead(x.get(), lookahead);
 
-        x->x_otl_output.reset(outlet_new(&x->x_obj, &s_signal));
+        x->x_inl_input.reset(nchannels - 1);
+        for (uint i = 0; i < (uint)nchannels - 1; ++i)
+            x->x_inl_input[i].reset(inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal));
+        x->x_otl_output.reset(nchannels);
+        for (uint i = 0; i < (uint)nchannels; ++i)
+            x->x_otl_output[i].reset(outlet_new(&x->x_obj, &s_signal));
+        x->x_otl_info.reset(outlet_new(&x->x_obj, nullptr));
     }
     catch (std::exception &ex) {
         error("%s", ex.what());
@@ -51,23 +144,51 @@ static t_limit *limit_new(t_symbol *s, int argc, t_atom *argv)
     return x.release();
 }
 
-static void limit_perform(
-    t_limit *x, const uint n, const t_sample *in, t_sample *out)
+// compute the gains over the peaks of the block, in place
+static void limit_gain_lookahead(t_limit *x, const uint n, t_float *buffer)
 {
-    const t_float at = 0.3_f;
-    const t_float rt = 0.01_f;
+    const t_float lt = x->x_lt;
+    const t_float releasecoef = x->x_releasecoef;
+    const uint lookahead = x->x_lookahead;
+    const double scale = 1.0 / lookahead;
+    sliding_max<t_float> &peakmax = x->x_peakmax;
+
+    t_float release = x->x_release;
+    t_float *gains = x->x_gains.data();
+    uint gainidx = x->x_gainidx;
+    double gainsum = x->x_gainsum;
+
+    for (uint i = 0; i < n; ++i) {
+        // the highest peak in the window, and the gain for it
+        t_float p = peakmax.process(buffer[i]);
+        t_float g = (p > lt) ? (lt / p) : 1;
+
+        // attack at once, release slowly
+        release = (g < release) ? g : (release + releasecoef * (g - release));
+
+        gainsum += release - gains[gainidx];
+        gains[gainidx] = release;
+        gainidx = (gainidx + 1 == lookahead) ? 0 : (gainidx + 1);
 
-    t_float *delay = x->x_delay.data();
-    uint ndelay = x->x_delay.size();
+        buffer[i] = gainsum * scale;
+    }
+
+    x->x_release = release;
+    x->x_gainidx = gainidx;
+    x->x_gainsum = gainsum;
+}
+
+static void limit_gain(t_limit *x, const uint n, t_float *buffer)
+{
+    const t_float at = x->x_at;
+    const t_float rt = x->x_rt;
 
     const t_float lt = x->x_lt;
     t_float xpeak = x->x_xpeak;
     t_float g = x->x_g;
-    uint delayidx = x->x_delayidx;
 
     for (uint i = 0; i < n; ++i) {
-        t_float x = in[i];
-        t_float a = std::fabs(x);
+        t_float a = buffer[i];
         t_float coeff = (a > xpeak) ? at : rt;
         xpeak = (1 - coeff) * xpeak + coeff * a;
 
@@ -76,21 +197,130 @@ static void limit_perform(
         coeff = (f < g) ? at : rt;
 
         g = (1 - coeff) * g + coeff * f;
-        out[i] = g * delay[delayidx];
-        delay[delayidx] = x;
-
-        delayidx = (delayidx == ndelay - 1) ? 0 : (delayidx + 1);
+        buffer[i] = g;
     }
 
     x->x_xpeak = xpeak;
     x->x_g = g;
-    x->x_delayidx = delayidx;
+}
+
+static void limit_process(
+    t_limit *x, const uint n,
+    const t_sample *const *in, t_sample *const *out)
+{
+    const uint nchannels = x->x_nchannels;
+    const uint lookahead = x->x_lookahead;
+    const bool truepeak = x->x_truepeak;
+    t_float *buffer = x->x_buffer.data();
+
+    const uint delaysize = x->x_delaysize;
+    const uint delaymask = delaysize - 1;
+    const uint delaylen = (lookahead > 0) ?
+        (lookahead - 1 + true_peak<t_float>::latency) : (limit_delay * x->x_osfactor);
+    const uint delayidx = x->x_delayidx;
+
+    // the inputs are all consumed before any output is written, which may
+    // share the memory of an input
+    std::fill_n(buffer, n, 0);
+    for (uint c = 0; c < nchannels; ++c) {
+        const t_sample *input = in[c];
+        t_float *delay = &x->x_delay[c * delaysize];
+        if (lookahead > 0) {
+            true_peak<t_float> &peak = x->x_peak[c];
+            for (uint i = 0; i < n; ++i)
+                buffer[i] = std::max(buffer[i], peak.process(input[i], truepeak));
+        }
+        else {
+#pragma omp simd
+            for (uint i = 0; i < n; ++i)
+                buffer[i] = std::max(buffer[i], std::fabs(input[i]));
+        }
+        for (uint i = 0; i < n; ++i)
+            delay[(delayidx + i) & delaymask] = input[i];
+    }
+
+    if (lookahead > 0)
+        limit_gain_lookahead(x, n, buffer);
+    else
+        limit_gain(x, n, buffer);
+
+    for (uint c = 0; c < nchannels; ++c) {
+        t_sample *output = out[c];
+        const t_float *delay = &x->x_delay[c * delaysize];
+        const uint start = delayidx - delaylen;
+#pragma omp simd
+        for (uint i = 0; i < n; ++i)
+            output[i] = buffer[i] * delay[(start + i) & delaymask];
+    }
+
+    x->x_delayidx = (delayidx + n) & delaymask;
+}
+
+static t_int *limit_perform(t_int *w)
+{
+    ++w;
+    t_limit *x = (t_limit *)*w++;
+    const uint n = *w++;
+    const uint nchannels = x->x_nchannels;
+    const t_sample *const *in = (const t_sample *const *)w;
+    t_sample *const *out = (t_sample *const *)(w + nchannels);
+
+    const uint factor = x->x_osfactor;
+    if (factor == 1) {
+        limit_process(x, n, in, out);
+        return w + 2 * nchannels;
+    }
+
+    // all the inputs upsampled before an output is written
+    t_float *buffers[limit_maxchannels];
+    for (uint c = 0; c < nchannels; ++c)
+        buffers[c] = x->x_os[c].up(in[c], n);
+    limit_process(x, n * factor, buffers, buffers);
+    for (uint c = 0; c < nchannels; ++c)
+        x->x_os[c].down(out[c], n);
+
+    return w + 2 * nchannels;
 }
 
 static void limit_dsp(t_limit *x, t_signal **sp)
 {
-    dsp_add_s(
-        limit_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+    const uint nchannels = x->x_nchannels;
+    const uint n = sp[0]->s_n;
+
+    if (x->x_blocksize != n) {
+        for (uint c = 0; c < nchannels; ++c) {
+            x->x_os[c] = oversampler<t_float, limit_maxoversample>(x->x_osmode, n);
+            x->x_os[c].factor(x->x_osfactor);
+        }
+        x->x_blocksize = n;
+    }
+
+    // the delay holds the block in addition to the longest delay, at the
+    // highest rate
+    const uint nmax = n * limit_maxoversample;
+    const uint maxdelay = std::max(
+        x->x_maxlookahead - 1 + true_peak<t_float>::latency,
+        limit_delay * limit_maxoversample);
+    uint delaysize = 1;
+    while (delaysize < maxdelay + nmax)
+        delaysize <<= 1;
+    if (x->x_delaysize != delaysize || x->x_buffer.size() != nmax) {
+        x->x_delay.reset(nchannels * delaysize);
+        x->x_delay.fill(0);
+        x->x_delaysize = delaysize;
+        x->x_delayidx = 0;
+        x->x_buffer.reset(nmax);
+    }
+
+    t_int elts[2 + 2 * limit_maxchannels];
+    uint index = 0;
+
+    elts[index++] = (t_int)x;
+    elts[index++] = n;
+    for (uint i = 0; i < 2 * nchannels; ++i)
+        elts[index++] = (t_int)sp[i]->s_vec;
+
+    dsp_addv(limit_perform, index, elts);
 }
 
 static void limit_threshold(t_limit *x, t_floatarg lt)
@@ -98,6 +328,111 @@ static void limit_threshold(t_limit *x, t_floatarg lt)
     x->x_lt = lt;
 }
 
+// set the coefficients for the rate of processing
+static void limit_set_rate(t_limit *x)
+{
+    const uint factor = x->x_osfactor;
+    const t_float fs = sys_getsr() * factor;
+    x->x_at = 1 - std::pow(1 - (f64)limit_attack, 1.0 / factor);
+    x->x_rt = 1 - std::pow(1 - (f64)limit_decay, 1.0 / factor);
+    x->x_releasecoef = 1 - std::exp(-1 / (limit_release * 1e-3_f * fs));
+}
+
+static void limit_set_lookahead(t_limit *x, t_float ms)
+{
+    const t_float fs = sys_getsr() * x->x_osfactor;
+    x->x_lookaheadms = ms;
+    uint length = std::lround(ms * 1e-3_f * fs);
+    length = std::min(length, x->x_maxlookahead);
+    if (ms > 0)
+        length = std::max(length, 1u);
+
+    x->x_lookahead = length;
+    if (length == 0)
+        return;
+
+    // start again with the window empty, and the gain at unity
+    x->x_peakmax.length(length);
+    std::fill_n(x->x_gains.data(), length, 1);
+    x->x_gainidx = 0;
+    x->x_gainsum = length;
+    x->x_release = 1;
+}
+
+// clear the delays and the detection of peaks, whose samples would otherwise
+// come out without having passed the window of the gain
+static void limit_clear(t_limit *x)
+{
+    const uint nchannels = x->x_nchannels;
+    x->x_delay.fill(0);
+    for (uint c = 0; c < nchannels; ++c)
+        x->x_peak[c].reset();
+}
+
+static void limit_lookahead(t_limit *x, t_floatarg ms)
+{
+    if (ms < 0 || ms > limit_maxlookahead) {
+        error("lookahead: must be between 0 and %g ms", limit_maxlookahead);
+        return;
+    }
+    limit_set_lookahead(x, ms);
+    limit_clear(x);
+}
+
+static void limit_truepeak(t_limit *x, t_floatarg f)
+{
+    x->x_truepeak = f != 0;
+}
+
+static void limit_oversample(t_limit *x, t_symbol *, int argc, t_atom *argv)
+{
+    int factor = (argc > 0) ? (int)atom_getfloat(&argv[0]) : 1;
+    t_symbol *mode = (argc > 1) ? atom_getsymbol(&argv[1]) : gensym("linear");
+    if (argc > 2 || (factor != 1 && factor != 2 && factor != 4 && factor != 8)) {
+        error("oversample: the factor must be 1, 2, 4 or 8");
+        return;
+    }
+    if (mode != gensym("linear") && mode != gensym("minimum")) {
+        error("oversample: the mode must be linear or minimum");
+        return;
+    }
+
+    oversampler_mode osmode = (mode == gensym("linear")) ?
+        oversampler_linear : oversampler_minimum;
+    const uint nchannels = x->x_nchannels;
+    try {
+        for (uint c = 0; c < nchannels; ++c) {
+            if (x->x_os[c].mode() != osmode)
+                x->x_os[c] = oversampler<t_float, limit_maxoversample>(osmode, x->x_blocksize);
+        }
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        return;
+    }
+    x->x_osfactor = factor;
+    x->x_osmode = osmode;
+    for (uint c = 0; c < nchannels; ++c)
+        x->x_os[c].factor(factor);
+
+    limit_set_rate(x);
+    limit_set_lookahead(x, x->x_lookaheadms);
+    limit_clear(x);
+}
+
+// output the delay of the signal, in milliseconds
+static void limit_latency(t_limit *x)
+{
+    const uint factor = x->x_osfactor;
+    const uint lookahead = x->x_lookahead;
+    const uint delaylen = (lookahead > 0) ?
+        (lookahead - 1 + true_peak<t_float>::latency) : (limit_delay * factor);
+    const f64 latency = (f64)delaylen / factor + x->x_os[0].latency();
+    t_atom msg;
+    SETFLOAT(&msg, 1e3 * latency / sys_getsr());
+    outlet_anything(x->x_otl_info.get(), gensym("latency"), 1, &msg);
+}
+
 PDEX_API
 void limit_tilde_setup()
 {
@@ -111,4 +446,16 @@ void limit_tilde_setup()
     class_addmethod(
         cls, (t_method)&limit_threshold, gensym("threshold"),
         A_DEFFLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&limit_lookahead, gensym("lookahead"),
+        A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&limit_truepeak, gensym("truepeak"),
+        A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&limit_oversample, gensym("oversample"),
+        A_GIMME, A_NULL);
+    class_addmethod(
+        cls, (t_method)&limit_latency, gensym("latency"),
+        A_NULL);
 }
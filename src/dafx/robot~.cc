@@ -5,10 +5,12 @@
 
 #include "util/pd++.h"
 #include "util/fftw++.h"
-#include "util/dsp/overlap_add.h"
+#include "util/dsp/stft.h"
+#include "util/dsp.h"
 #include <jsl/math>
 #include <jsl/types>
 #include <algorithm>
+#include <cstring>
 
 #if PD_FLOATSIZE == 32
 # define FFTW(x) fftwf_##x
@@ -16,21 +18,33 @@
 # define FFTW(x) fftw_##x
 #endif
 
+// the sizes of window allowed, and the shortest step
+static constexpr uint robot_minwinsize = 64;
+static constexpr uint robot_maxwinsize = 8192;
+static constexpr uint robot_minstep = 16;
+// unit phasors to choose the random phases from, by the high bits
+static constexpr uint robot_phasebits = 10;
+static constexpr uint robot_numphases = 1u << robot_phasebits;
+
+enum robot_effect {
+    robot_effect_robot,        // phases at zero
+    robot_effect_whisper,      // phases random
+    robot_effect_passthrough,  // spectrum unchanged
+};
+
 struct t_robot : pd_basic_object<t_robot> {
     t_float x_signalin = 0;
-    //
-    pd_dynarray<t_float> x_inbuf;
-    pd_dynarray<t_float> x_outbuf;
-    uint x_bufidx = 0;
-    //
-    uint x_step = 0;
-    overlap_add<t_float> x_ola;
-    pd_dynarray<t_float> x_hist;
-    uint x_histidx = 0;
-    FFTW(dynarray)<t_float> x_real;
-    FFTW(dynarray)<t_complex> x_cplx;
-    FFTW(plan_u) x_fwd;
-    FFTW(plan_u) x_bwd;
+    // pitch when the signal of pitch is not positive
+    t_float x_freq = 0;
+    t_float x_rate = 0;
+    stft<FFTW(api)> x_stft;
+    robot_effect x_effect = robot_effect_robot;
+    u32 x_seed = 0;
+    // magnitudes and phasors of the bins, the table of random phasors
+    pd_dynarray<t_float> x_mag;
+    pd_dynarray<t_complex> x_phasor;
+    pd_dynarray<t_complex> x_phases;
+    u_inlet x_inl_pitch;
     u_outlet x_otl_output;
 };
 
@@ -42,8 +56,10 @@ static void *robot_new(t_symbol *s, int argc, t_atom argv[])
         x = pd_make_instance<t_robot>();
 
         t_float robotfreq = 440;
+        uint winsize = 1024;
 
         switch (argc) {
+        case 2: winsize = (int)atom_getfloat(&argv[1]);  // fall through
         case 1: robotfreq = atom_getfloat(&argv[0]);  // fall through
         case 0: break;
         default: return nullptr;
@@ -56,33 +72,35 @@ static void *robot_new(t_symbol *s, int argc, t_atom argv[])
 
         const t_float fs = sys_getsr();
         const uint step = fs / robotfreq;
-        if (step < 16) {
+        if (step < robot_minstep) {
             error("frequency parameter too high");
             return nullptr;
         }
 
-        x->x_step = step;
-        x->x_inbuf.reset(step);
-        x->x_outbuf.reset(step);
-
-        const uint winsize = 1024;
-        jsl::dynarray<t_float> window(winsize);
-
-        for (uint i = 0, n = winsize; i < n; ++i)
-            window[i] = jsl::square(std::sin(i * M_PI / n));
-
-        x->x_ola = overlap_add<t_float>(step, window);
-        x->x_hist.reset(winsize);
+        x->x_freq = robotfreq;
+        x->x_rate = fs;
+
+        // windows and plans for all sizes, to change without allocating
+        x->x_stft = stft<FFTW(api)>(
+            robot_minwinsize, robot_maxwinsize,
+            [](t_float *window, size_t n) {
+                for (size_t i = 0; i < n; ++i)
+                    window[i] = jsl::square(std::sin(i * M_PI / n));
+            });
+        if (!x->x_stft.winsize(winsize)) {
+            error("window size must be a power of two between %u and %u",
+                  robot_minwinsize, robot_maxwinsize);
+            return nullptr;
+        }
 
-        x->x_real.reset(winsize);
-        x->x_cplx.reset(winsize / 2 + 1);
-        t_float *real = x->x_real.data();
-        t_complex *cplx = x->x_cplx.data();
-        x->x_fwd.reset(FFTW(plan_dft_r2c_1d)(winsize, real, cplx, 0));
-        x->x_bwd.reset(FFTW(plan_dft_c2r_1d)(winsize, cplx, real, 0));
-        if (!x->x_fwd || !x->x_fwd)
-            throw std::runtime_error("error planning FFT");
+        const uint maxbins = robot_maxwinsize / 2 + 1;
+        x->x_mag.reset(maxbins);
+        x->x_phasor.reset(maxbins);
+        x->x_phases.reset(robot_numphases);
+        for (uint i = 0; i < robot_numphases; ++i)
+            x->x_phases[i] = std::polar(1.0_f, (t_float)(2 * M_PI * i / robot_numphases));
 
+        x->x_inl_pitch.reset(inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal));
         x->x_otl_output.reset(outlet_new(&x->x_obj, &s_signal));
     }
     catch (std::exception &ex) {
@@ -93,75 +111,94 @@ static void *robot_new(t_symbol *s, int argc, t_atom argv[])
     return x.release();
 }
 
-static void robot_step(t_robot *x, const t_float *in, t_float *out)
+// the magnitudes with new phases, or the spectrum as it is
+static void robot_frame(t_robot *x, t_complex *spec, uint bins)
 {
-    const uint step = x->x_step;
-    overlap_add<t_float> &ola = x->x_ola;
-
-    const t_float *window = ola.window().data();
-    uint winsize = ola.window().size();
-
-    t_float *hist = x->x_hist.data();
-    uint histidx = x->x_histidx;
-
-    for (uint i = 0; i < step; ++i) {
-        hist[histidx] = in[i];
-        histidx = (histidx == winsize - 1) ? 0 : (histidx + 1);
+    t_float *mag = x->x_mag.data();
+    t_complex *phasor = x->x_phasor.data();
+    t_float wet = 1, dry = 0;
+
+    switch (x->x_effect) {
+    case robot_effect_robot:
+        std::fill_n(phasor, bins, t_complex(1));
+        break;
+    case robot_effect_whisper: {
+        const t_complex *phases = x->x_phases.data();
+        u32 seed = x->x_seed;
+        for (uint i = 0; i < bins; ++i)
+            phasor[i] = phases[fastrandom(&seed) >> (32 - robot_phasebits)];
+        x->x_seed = seed;
+        break;
+    }
+    case robot_effect_passthrough:
+        std::fill_n(phasor, bins, t_complex(0));
+        wet = 0;
+        dry = 1;
+        break;
     }
 
-    FFTW(plan) fwd = x->x_fwd.get();
-    FFTW(plan) bwd = x->x_bwd.get();
-    t_float *real = x->x_real.data();
-    t_complex *cplx = x->x_cplx.data();
+    magnitude(spec, mag, bins);
 
-    for (uint i = 0, j = histidx; i < winsize; ++i) {
-        real[i] = window[i] * hist[j];
-        j = (j == winsize - 1) ? 0 : (j + 1);
+    t_float *ri = reinterpret_cast<t_float *>(spec);
+    const t_float *pri = reinterpret_cast<const t_float *>(phasor);
+#pragma omp simd
+    for (uint i = 0; i < bins; ++i) {
+        t_float m = wet * mag[i];
+        ri[2 * i] = m * pri[2 * i] + dry * ri[2 * i];
+        ri[2 * i + 1] = m * pri[2 * i + 1] + dry * ri[2 * i + 1];
     }
+}
 
-    FFTW(execute_dft_r2c)(fwd, real, cplx);
-    for (uint i = 0; i < winsize / 2 + 1; ++i)
-        cplx[i] = std::abs(cplx[i]);
-    FFTW(execute_dft_c2r)(bwd, cplx, real);
-    for (uint i = 0; i < winsize; ++i)
-        real[i] /= winsize;
-
-    ola.process(real, out);
+static void robot_perform(
+    t_robot *x, uint n, const t_sample *in, const t_sample *pitch, t_sample *out)
+{
+    const t_float fs = x->x_rate;
+    const t_float freq = x->x_freq;
+    stft<FFTW(api)> &stft = x->x_stft;
+
+    // one period of the robot voice between frames
+    auto hop = [&](size_t offset) -> size_t {
+        t_float f = pitch[offset];
+        f = (f > 0) ? f : freq;
+        t_float step = jsl::clamp(fs / f, (t_float)robot_minstep, (t_float)stft.winsize());
+        return step;
+    };
+
+    auto frame = [x](t_complex *spec, size_t bins) { robot_frame(x, spec, bins); };
+    stft.process(in, out, n, frame, hop);
+}
 
-    x->x_histidx = histidx;
+static void robot_dsp(t_robot *x, t_signal **sp)
+{
+    dsp_add_s(robot_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec);
 }
 
-static void robot_perform(
-    t_robot *x, uint nleft, const t_sample *in, t_sample *out)
+static void robot_window(t_robot *x, t_float f)
 {
-    const uint step = x->x_step;
-    t_float *inbuf = x->x_inbuf.data();
-    t_float *outbuf = x->x_outbuf.data();
-    uint bufidx = x->x_bufidx;
-
-    while (nleft > 0) {
-        if (bufidx == step) {
-            robot_step(x, inbuf, outbuf);
-            bufidx = 0;
-        }
-        uint nfrombuf = step - bufidx;
-        nfrombuf = (nleft < nfrombuf) ? nleft : nfrombuf;
-        for (uint i = 0; i < nfrombuf; ++i) {
-            inbuf[i + bufidx] = in[i];
-            out[i] = outbuf[i + bufidx];
-        }
-        in += nfrombuf;
-        out += nfrombuf;
-        nleft -= nfrombuf;
-        bufidx += nfrombuf;
-    }
+    if (!x->x_stft.winsize((int)f))
+        error("window: must be a power of two between %u and %u",
+              robot_minwinsize, robot_maxwinsize);
+}
 
-    x->x_bufidx = bufidx;
+static void robot_mode(t_robot *x, t_symbol *s)
+{
+    if (!strcmp(s->s_name, "robot"))
+        x->x_effect = robot_effect_robot;
+    else if (!strcmp(s->s_name, "whisper"))
+        x->x_effect = robot_effect_whisper;
+    else if (!strcmp(s->s_name, "passthrough"))
+        x->x_effect = robot_effect_passthrough;
+    else
+        error("mode: must be robot, whisper or passthrough");
 }
 
-void robot_dsp(t_robot *x, t_signal **sp)
+static void robot_freq(t_robot *x, t_float f)
 {
-    dsp_add_s(robot_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+    if (!(f > 0)) {
+        error("freq: must be positive");
+        return;
+    }
+    x->x_freq = f;
 }
 
 PDEX_API
@@ -174,4 +211,10 @@ void robot_tilde_setup()
         cls, t_robot, x_signalin);
     class_addmethod(
         cls, (t_method)&robot_dsp, gensym("dsp"), A_CANT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&robot_window, gensym("window"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&robot_freq, gensym("freq"), A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&robot_mode, gensym("mode"), A_SYMBOL, A_NULL);
 }
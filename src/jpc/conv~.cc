@@ -0,0 +1,303 @@
+/* conv~ - Convolution with an impulse response, partitioned in frequency
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#include "util/pd++.h"
+#include "util/fftw++.h"
+#include <jsl/types>
+#include <algorithm>
+
+#if PD_FLOATSIZE == 32
+# define FFTW(x) fftwf_##x
+#elif PD_FLOATSIZE == 64
+# define FFTW(x) fftw_##x
+#endif
+
+static constexpr uint conv_defpartsize = 64;
+static constexpr uint conv_minpartsize = 16;
+static constexpr uint conv_maxpartsize = 16384;
+
+// the impulse response is cut in partitions of equal size N. the first one is
+// convolved in the time domain, without latency, and the others in the
+// frequency domain by overlap-save, while the next N input samples arrive.
+struct t_conv : pd_basic_object<t_conv> {
+    t_float x_signalin = 0;
+    t_symbol *x_arrayname = nullptr;
+    bool x_loaded = false;
+    uint x_partsize = 0;
+    // first partition reversed, and the input history, stored twice
+    pd_dynarray<t_float> x_head;
+    pd_dynarray<t_float> x_hist;
+    uint x_histidx = 0;
+    // the two last input partitions, and the tail of the output
+    pd_dynarray<t_float> x_inbuf;
+    pd_dynarray<t_float> x_tailbuf;
+    uint x_bufidx = 0;
+    // spectra of the partitions after the first, and of the past inputs
+    uint x_numparts = 0;
+    pd_dynarray<t_complex> x_irspec;
+    pd_dynarray<t_complex> x_fdl;
+    uint x_fdlidx = 0;
+    FFTW(dynarray)<t_float> x_real;
+    FFTW(dynarray)<t_complex> x_cplx;
+    FFTW(plan) x_fwd = nullptr;
+    FFTW(plan) x_bwd = nullptr;
+    u_outlet x_otl_output;
+};
+
+static void *conv_new(t_symbol *s, int argc, t_atom argv[])
+{
+    u_pd<t_conv> x;
+
+    try {
+        x = pd_make_instance<t_conv>();
+
+        t_symbol *arrayname = &s_;
+        uint partsize = conv_defpartsize;
+
+        switch (argc) {
+        case 2: partsize = (int)atom_getfloat(&argv[1]);  // fall through
+        case 1: arrayname = atom_getsymbol(&argv[0]);  // fall through
+        case 0: break;
+        default: return nullptr;
+        }
+
+        if ((int)partsize < (int)conv_minpartsize || partsize > conv_maxpartsize ||
+            (partsize & (partsize - 1)) != 0) {
+            error("partition size must be a power of two between %u and %u",
+                  conv_minpartsize, conv_maxpartsize);
+            return nullptr;
+        }
+
+        const uint fftsize = 2 * partsize;
+        x->x_arrayname = arrayname;
+        x->x_partsize = partsize;
+        x->x_head.reset(partsize);
+        x->x_hist.reset(2 * partsize);
+        x->x_inbuf.reset(fftsize);
+        x->x_tailbuf.reset(partsize);
+
+        x->x_real.reset(fftsize);
+        x->x_cplx.reset(partsize + 1);
+        t_float *real = x->x_real.data();
+        t_complex *cplx = x->x_cplx.data();
+        x->x_fwd = FFTW(plan_cache)::r2c_1d(fftsize, real, cplx);
+        x->x_bwd = FFTW(plan_cache)::c2r_1d(fftsize, cplx, real);
+
+        x->x_otl_output.reset(outlet_new(&x->x_obj, &s_signal));
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        x.reset();
+    }
+
+    return x.release();
+}
+
+static void conv_clear(t_conv *x)
+{
+    x->x_hist.fill(0);
+    x->x_histidx = 0;
+    x->x_inbuf.fill(0);
+    x->x_tailbuf.fill(0);
+    x->x_bufidx = 0;
+    x->x_fdl.fill(0);
+    x->x_fdlidx = 0;
+}
+
+static void conv_load(t_conv *x, t_symbol *arrayname)
+{
+    x->x_arrayname = arrayname;
+    x->x_loaded = false;
+
+    if (arrayname == &s_)
+        return;
+
+    t_garray *array = (t_garray *)pd_findbyclass(arrayname, garray_class);
+    int size = 0;
+    t_word *vec = nullptr;
+    if (!array) {
+        error("%s: no such array", arrayname->s_name);
+        return;
+    }
+    if (!garray_getfloatwords(array, &size, &vec)) {
+        error("%s: bad template for conv~", arrayname->s_name);
+        return;
+    }
+
+    const uint partsize = x->x_partsize;
+    const uint fftsize = 2 * partsize;
+    const uint nbins = partsize + 1;
+    const uint length = size;
+    const uint numparts = (length > partsize) ?
+        ((length - 1) / partsize) : 0;
+
+    t_float *head = x->x_head.data();
+    for (uint i = 0; i < partsize; ++i)
+        head[partsize - 1 - i] = (i < length) ? vec[i].w_float : 0;
+
+    try {
+        x->x_irspec.reset(numparts * nbins);
+        x->x_fdl.reset(numparts * nbins);
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        x->x_numparts = 0;
+        return;
+    }
+    x->x_numparts = numparts;
+
+    // spectra of the partitions, zero-padded, with the scale of the inverse
+    t_float *real = x->x_real.data();
+    t_complex *cplx = x->x_cplx.data();
+    const t_float scale = 1.0_f / fftsize;
+    for (uint p = 0; p < numparts; ++p) {
+        for (uint i = 0; i < partsize; ++i) {
+            uint index = (p + 1) * partsize + i;
+            real[i] = (index < length) ? (scale * vec[index].w_float) : 0;
+        }
+        std::fill(&real[partsize], &real[fftsize], 0);
+        FFTW(execute_dft_r2c)(x->x_fwd, real, cplx);
+        std::copy(&cplx[0], &cplx[nbins], &x->x_irspec[p * nbins]);
+    }
+
+    conv_clear(x);
+    x->x_loaded = true;
+}
+
+// multiply-accumulate of complex spectra
+static void conv_mac(
+    t_complex *acc_, const t_complex *a_, const t_complex *b_, uint n)
+{
+    t_float *acc = (t_float *)acc_;
+    const t_float *a = (const t_float *)a_;
+    const t_float *b = (const t_float *)b_;
+#pragma omp simd
+    for (uint i = 0; i < n; ++i) {
+        t_float ar = a[2 * i], ai = a[2 * i + 1];
+        t_float br = b[2 * i], bi = b[2 * i + 1];
+        acc[2 * i] += ar * br - ai * bi;
+        acc[2 * i + 1] += ar * bi + ai * br;
+    }
+}
+
+// compute the tail of the output for the next partition, from the input
+// partition which just completed
+static void conv_step(t_conv *x)
+{
+    const uint partsize = x->x_partsize;
+    const uint fftsize = 2 * partsize;
+    const uint nbins = partsize + 1;
+    const uint numparts = x->x_numparts;
+
+    t_float *inbuf = x->x_inbuf.data();
+    t_float *real = x->x_real.data();
+    t_complex *cplx = x->x_cplx.data();
+    const t_complex *irspec = x->x_irspec.data();
+    t_complex *fdl = x->x_fdl.data();
+
+    std::copy(&inbuf[0], &inbuf[fftsize], &real[0]);
+    std::copy(&inbuf[partsize], &inbuf[fftsize], &inbuf[0]);
+
+    if (numparts == 0)
+        return;
+
+    // the spectrum of the input enters the delay line
+    const uint fdlidx = x->x_fdlidx;
+    FFTW(execute_dft_r2c)(x->x_fwd, real, cplx);
+    std::copy(&cplx[0], &cplx[nbins], &fdl[fdlidx * nbins]);
+
+    // each partition meets the input which is as many partitions old
+    std::fill(&cplx[0], &cplx[nbins], 0);
+    for (uint p = 0; p < numparts; ++p) {
+        uint index = (fdlidx >= p) ? (fdlidx - p) : (fdlidx + numparts - p);
+        conv_mac(cplx, &irspec[p * nbins], &fdl[index * nbins], nbins);
+    }
+
+    // the second half is free of circular aliasing
+    FFTW(execute_dft_c2r)(x->x_bwd, cplx, real);
+    std::copy(&real[partsize], &real[fftsize], x->x_tailbuf.data());
+
+    x->x_fdlidx = (fdlidx + 1 == numparts) ? 0 : (fdlidx + 1);
+}
+
+static void conv_perform(
+    t_conv *x, uint nleft, const t_sample *in, t_sample *out)
+{
+    if (!x->x_loaded) {
+        std::fill(out, out + nleft, 0);
+        return;
+    }
+
+    const uint partsize = x->x_partsize;
+    const t_float *head = x->x_head.data();
+    t_float *hist = x->x_hist.data();
+    t_float *inbuf = x->x_inbuf.data();
+    const t_float *tailbuf = x->x_tailbuf.data();
+    uint histidx = x->x_histidx;
+    uint bufidx = x->x_bufidx;
+
+    while (nleft > 0) {
+        if (bufidx == partsize) {
+            conv_step(x);
+            bufidx = 0;
+        }
+        uint count = partsize - bufidx;
+        count = (nleft < count) ? nleft : count;
+        for (uint i = 0; i < count; ++i) {
+            t_float input = in[i];
+            inbuf[partsize + bufidx + i] = input;
+            hist[histidx] = hist[histidx + partsize] = input;
+            const t_float *past = &hist[histidx + 1];
+            t_float r = 0;
+#pragma omp simd reduction(+: r)
+            for (uint j = 0; j < partsize; ++j)
+                r += head[j] * past[j];
+            histidx = (histidx + 1) & (partsize - 1);
+            out[i] = r + tailbuf[bufidx + i];
+        }
+        in += count;
+        out += count;
+        nleft -= count;
+        bufidx += count;
+    }
+
+    x->x_histidx = histidx;
+    x->x_bufidx = bufidx;
+}
+
+static void conv_dsp(t_conv *x, t_signal **sp)
+{
+    // the array may be defined after this object
+    if (!x->x_loaded)
+        conv_load(x, x->x_arrayname);
+    dsp_add_s(conv_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+}
+
+static void conv_set(t_conv *x, t_symbol *s)
+{
+    conv_load(x, s);
+}
+
+static void conv_reset(t_conv *x)
+{
+    if (x->x_loaded)
+        conv_clear(x);
+}
+
+PDEX_API
+void conv_tilde_setup()
+{
+    t_class *cls = pd_make_class<t_conv>(
+        gensym("conv~"), (t_newmethod)&conv_new,
+        CLASS_DEFAULT, A_GIMME, A_NULL);
+    CLASS_MAINSIGNALIN(
+        cls, t_conv, x_signalin);
+    class_addmethod(
+        cls, (t_method)&conv_dsp, gensym("dsp"), A_CANT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&conv_set, gensym("set"), A_SYMBOL, A_NULL);
+    class_addmethod(
+        cls, (t_method)&conv_reset, gensym("reset"), A_NULL);
+}
@@ -18,6 +18,12 @@
     converted to Puredata by Jean-Pierre Cimalando, 2017.
 */
 
+// Implementation notes
+//     several taps may read the same line, each with a delay inlet and an
+//     output of its own, the input being written once for all of them
+//     the line is circular, of a power of 2 which holds the longest delay
+//     in addition to the block, which is written entirely before reading
+
 #include "util/pd++.h"
 #include <jsl/dynarray>
 #include <jsl/math>
@@ -25,16 +31,21 @@
 #include <cmath>
 #include <algorithm>
 
+static constexpr uint delayA_maxtaps = 64;
+
 struct t_delayA : pd_basic_object<t_delayA> {
     t_float x_signalin = 0;
-    int x_maxsamples = 0;
-    t_float x_lastframe = 0;
-    t_float x_apinput = 0;
+    uint x_ntaps = 0;
+    uint x_maxsamples = 0;
+    // states of the allpass of the taps
+    pd_dynarray<t_float> x_lastframe;
+    pd_dynarray<t_float> x_apinput;
     uint x_inpoint = 0;
-    uint x_outpoint = 0;
     pd_dynarray<t_float> x_inputs;
-    u_inlet x_inl_delay;
-    u_outlet x_otl_output;
+    // delays of the taps over the block, in samples
+    pd_dynarray<t_float> x_delays;
+    pd_dynarray<u_inlet> x_inl_delay;
+    pd_dynarray<u_outlet> x_otl_output;
 };
 
 static void *delayA_new(t_symbol *s, int argc, t_atom *argv)
@@ -45,7 +56,10 @@ static void *delayA_new(t_symbol *s, int argc, t_atom *argv)
         x = pd_make_instance<t_delayA>();
 
         t_float maxdelay = 1;
+        int ntaps = 1;
         switch (argc) {
+        case 2:
+            ntaps = (int)atom_getfloat(&argv[1]);  // fall through
         case 1:
             maxdelay = atom_getfloat(&argv[0]); break;
         case 0:
@@ -54,18 +68,26 @@ static void *delayA_new(t_symbol *s, int argc, t_atom *argv)
             return nullptr;
         }
 
-        if (maxdelay <= 0)
+        if (maxdelay <= 0 || ntaps < 1 || (uint)ntaps > delayA_maxtaps)
             return nullptr;
 
-        x->x_inl_delay.reset(inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal));
-        x->x_otl_output.reset(outlet_new(&x->x_obj, &s_signal));
+        x->x_inl_delay.reset(ntaps);
+        for (uint k = 0; k < (uint)ntaps; ++k)
+            x->x_inl_delay[k].reset(inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal));
+        x->x_otl_output.reset(ntaps);
+        for (uint k = 0; k < (uint)ntaps; ++k)
+            x->x_otl_output[k].reset(outlet_new(&x->x_obj, &s_signal));
 
         const t_float fs = sys_getsr();
         uint maxsamples = std::ceil(maxdelay * fs);
         maxsamples = std::max(maxsamples, 1u);
 
+        x->x_ntaps = ntaps;
         x->x_maxsamples = maxsamples;
-        x->x_inputs.reset(maxsamples);
+        x->x_lastframe.reset(ntaps);
+        x->x_lastframe.fill(0);
+        x->x_apinput.reset(ntaps);
+        x->x_apinput.fill(0);
     }
     catch (std::exception &ex) {
         error("%s", ex.what());
@@ -75,69 +97,138 @@ static void *delayA_new(t_symbol *s, int argc, t_atom *argv)
     return x.release();
 }
 
-static void delayA_perform(
-    t_delayA *x, const uint n,
-    const t_sample *in, const t_sample *del, t_sample *out)
+// split a read position relative to the input into the offset of the
+// sample, and the fractional part of the allpass
+static inline t_float delayA_position(t_float outpointer, int *offset)
 {
-    const t_float fs = sys_getsr();
-
-    t_float lastframe = x->x_lastframe;
-    const uint maxsamples = x->x_maxsamples;
-    t_float apinput = x->x_apinput;
-    uint inpoint = x->x_inpoint;
-    uint outpoint = x->x_outpoint;
-    t_float *inputs = x->x_inputs.data();
-
-    for (uint i = 0; i < n; ++i) {
-        t_float delay = jsl::clamp((t_float)del[i] * fs, 0.5_f, (t_float)maxsamples);
+    t_float integral = std::floor(outpointer);
+    t_float alpha = 1 + integral - outpointer;  // fractional part
+
+    // The optimal range for alpha is about 0.5 - 1.5 in order to
+    // achieve the flattest phase delay response.
+    int low = alpha < 0.5_f;
+    *offset = (int)integral + low;
+    return alpha + low;
+}
 
-        //
-        t_float outpointer = inpoint - delay + 1;  // outPoint chases inpoint
-        while (outpointer < 0)
-            outpointer += maxsamples;  // modulo maximum length
+static t_int *delayA_perform(t_int *w)
+{
+    ++w;
+    t_delayA *x = (t_delayA *)*w++;
+    const uint n = *w++;
+    const uint ntaps = x->x_ntaps;
+    const t_sample *in = (const t_sample *)*w++;
+    const t_sample *const *del = (const t_sample *const *)w;
+    t_sample *const *out = (t_sample *const *)(w + ntaps);
 
-        outpoint = outpointer;  // integer part
-        outpoint = (outpoint == maxsamples) ? 0 : outpoint;
-        t_float alpha = 1 + outpoint - outpointer; // fractional part
+    const t_float fs = sys_getsr();
 
-        if (alpha < 0.5_f) {
-            // The optimal range for alpha is about 0.5 - 1.5 in order to
-            // achieve the flattest phase delay response.
-            outpoint += 1;
-            outpoint = (outpoint >= maxsamples) ? (outpoint - maxsamples) : outpoint;
-            alpha += 1;
+    const t_float maxsamples = x->x_maxsamples;
+    const uint inpoint = x->x_inpoint;
+    t_float *inputs = x->x_inputs.data();
+    const uint mask = x->x_inputs.size() - 1;
+    t_float *delays = x->x_delays.data();
+
+    // consume all the inputs before writing the outputs, which may share
+    // their memory
+    for (uint i = 0; i < n; ++i)
+        inputs[(inpoint + i) & mask] = in[i];
+    // taps of which the delay is the same over the block take a fast path
+    bool constant[delayA_maxtaps];
+    for (uint k = 0; k < ntaps; ++k) {
+        const t_sample *delk = del[k];
+        t_float *delaysk = &delays[k * n];
+        const t_sample del0 = delk[0];
+        int same = 1;
+#pragma omp simd reduction(&: same)
+        for (uint i = 0; i < n; ++i) {
+            delaysk[i] = jsl::clamp((t_float)delk[i] * fs, 0.5_f, maxsamples);
+            same &= delk[i] == del0;
         }
+        constant[k] = same;
+    }
 
-        t_float coeff = (1 - alpha) / (1 + alpha);  // coefficient for allpass
+    for (uint k = 0; k < ntaps; ++k) {
+        const t_float *delaysk = &delays[k * n];
+        t_sample *outk = out[k];
+        t_float lastframe = x->x_lastframe[k];
+        t_float apinput = x->x_apinput[k];
+
+        if (constant[k]) {
+            // the coefficient is computed once, and the line read by
+            // contiguous segments, which end where it wraps
+            int offset;
+            t_float alpha = delayA_position(1 - delaysk[0], &offset);
+            t_float coeff = (1 - alpha) / (1 + alpha);  // coefficient for allpass
+
+            for (uint i = 0; i < n;) {
+                const uint outpoint = (inpoint + offset + i) & mask;
+                const uint m = std::min(n - i, mask + 1 - outpoint);
+                const t_float *src = &inputs[outpoint];
+                t_sample *dst = &outk[i];
+                for (uint j = 0; j < m; ++j) {
+                    // Do allpass interpolation delay.
+                    lastframe = coeff * (src[j] - lastframe) + apinput;
+                    apinput = src[j];
+                    dst[j] = lastframe;
+                }
+                i += m;
+            }
+        }
+        else {
+            for (uint i = 0; i < n; ++i) {
+                int offset;
+                t_float alpha = delayA_position((t_float)i - delaysk[i] + 1, &offset);
+                uint outpoint = (inpoint + offset) & mask;  // modulo length
 
-        //
-        inputs[inpoint++] = in[i];
+                t_float coeff = (1 - alpha) / (1 + alpha);  // coefficient for allpass
 
-        // Increment input pointer modulo length.
-        inpoint = (inpoint == maxsamples) ? 0 : inpoint;
+                // Do allpass interpolation delay.
+                lastframe = -coeff * lastframe;
+                lastframe += apinput + (coeff * inputs[outpoint]);
 
-        // Do allpass interpolation delay.
-        lastframe = -coeff * lastframe;
-        lastframe += apinput + (coeff * inputs[outpoint]);
+                // Save the allpass input.
+                apinput = inputs[outpoint];
 
-        // Save the allpass input and increment modulo length.
-        apinput = inputs[outpoint++];
-        outpoint = (outpoint == maxsamples) ? 0 : outpoint;
+                outk[i] = lastframe;
+            }
+        }
 
-        out[i] = lastframe;
+        x->x_lastframe[k] = lastframe;
+        x->x_apinput[k] = apinput;
     }
 
-    x->x_lastframe = lastframe;
-    x->x_apinput = apinput;
-    x->x_inpoint = inpoint;
-    x->x_outpoint = outpoint;
+    // Increment input pointer modulo length.
+    x->x_inpoint = (inpoint + n) & mask;
+
+    return w + 2 * ntaps;
 }
 
 static void delayA_dsp(t_delayA *x, t_signal **sp)
 {
-    dsp_add_s(
-        delayA_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec,
-        sp[2]->s_vec);
+    const uint ntaps = x->x_ntaps;
+    const uint n = sp[0]->s_n;
+
+    // the line holds the block in addition to the longest delay
+    uint size = 1;
+    while (size < x->x_maxsamples + n)
+        size <<= 1;
+    if (x->x_inputs.size() != size || x->x_delays.size() != ntaps * n) {
+        x->x_inputs.reset(size);
+        x->x_inputs.fill(0);
+        x->x_inpoint = 0;
+        x->x_delays.reset(ntaps * n);
+    }
+
+    t_int elts[3 + 2 * delayA_maxtaps];
+    uint index = 0;
+
+    elts[index++] = (t_int)x;
+    elts[index++] = n;
+    for (uint i = 0; i < 1 + 2 * ntaps; ++i)
+        elts[index++] = (t_int)sp[i]->s_vec;
+
+    dsp_addv(delayA_perform, index, elts);
 }
 
 PDEX_API
@@ -19,9 +19,16 @@
     converted to Puredata by Jean-Pierre Cimalando, 2017.
 */
 
+// Implementation notes
+//     antiderivative antialiasing of the clipped cubic, as an option
+//     oversampling, as an option, the function running at the higher rate
+
 #include "util/pd++.h"
+#include "util/dsp/adaa.h"
+#include "util/dsp/oversampler.h"
 #include <jsl/math>
 #include <jsl/types>
+#include <algorithm>
 
 struct t_nlcubic : pd_basic_object<t_nlcubic> {
     t_float x_signalin = 0;
@@ -29,9 +36,18 @@ struct t_nlcubic : pd_basic_object<t_nlcubic> {
     t_float x_a2 = 0.5;
     t_float x_a3 = 0.5;
     t_float x_threshold = 1;
+    clipped_cubic<f64> x_shape;
+    adaa<f64> x_adaa;
+    oversampler<t_float, 8> x_os;
+    uint x_osfactor = 1;
+    oversampler_mode x_osmode = oversampler_linear;
+    uint x_blocksize = 0;
     u_outlet x_otl_output;
+    u_outlet x_otl_info;
 };
 
+static void nlcubic_update(t_nlcubic *x);
+
 static t_nlcubic *nlcubic_new(t_symbol *, int argc, t_atom *argv)
 {
     u_pd<t_nlcubic> x;
@@ -40,9 +56,17 @@ static t_nlcubic *nlcubic_new(t_symbol *, int argc, t_atom *argv)
         x = pd_make_instance<t_nlcubic>();
 
         x->x_otl_output.reset(outlet_new(&x->x_obj, &s_signal));
+        x->x_otl_info.reset(outlet_new(&x->x_obj, nullptr));
 
         if (argc != 0)
             return nullptr;
+
+        nlcubic_update(x.get());
+
+        // for the usual block, until the DSP is started
+        x->x_blocksize = 64;
+        x->x_os = oversampler<t_float, 8>(x->x_osmode, x->x_blocksize);
+        x->x_os.factor(x->x_osfactor);
     }
     catch (std::exception &ex) {
         error("%s", ex.what());
@@ -52,7 +76,7 @@ static t_nlcubic *nlcubic_new(t_symbol *, int argc, t_atom *argv)
     return x.release();
 }
 
-static void nlcubic_perform(
+static void nlcubic_process(
     t_nlcubic *x, const uint n, const t_sample *in, t_sample *out)
 {
     const t_float a1 = x->x_a1;
@@ -60,6 +84,12 @@ static void nlcubic_perform(
     const t_float a3 = x->x_a3;
     const t_float threshold = x->x_threshold;
 
+    adaa<f64> &aa = x->x_adaa;
+    if (aa.order() > 0) {
+        aa.process(x->x_shape, in, out, n);
+        return;
+    }
+
     for (uint i = 0; i < n; ++i) {
         t_float input = in[i];
 
@@ -75,14 +105,44 @@ static void nlcubic_perform(
     }
 }
 
+static void nlcubic_perform(
+    t_nlcubic *x, const uint n, const t_sample *in, t_sample *out)
+{
+    oversampler<t_float, 8> &os = x->x_os;
+    const uint factor = os.factor();
+    if (factor == 1) {
+        nlcubic_process(x, n, in, out);
+        return;
+    }
+
+    t_float *buffer = os.up(in, n);
+    nlcubic_process(x, n * factor, buffer, buffer);
+    os.down(out, n);
+}
+
 static void nlcubic_dsp(t_nlcubic *x, t_signal **sp)
 {
+    const uint n = sp[0]->s_n;
+    if (x->x_blocksize != n) {
+        x->x_os = oversampler<t_float, 8>(x->x_osmode, n);
+        x->x_os.factor(x->x_osfactor);
+        x->x_blocksize = n;
+    }
     dsp_add_s(nlcubic_perform, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
 }
 
+// compute the pieces of the function and its antiderivatives
+static void nlcubic_update(t_nlcubic *x)
+{
+    const f64 coef[4] = {0, x->x_a1, x->x_a2, x->x_a3};
+    x->x_shape.set(coef, std::max<f64>(x->x_threshold, 0));
+    x->x_adaa.update(x->x_shape);
+}
+
 static void nlcubic_threshold(t_nlcubic *x, t_floatarg t)
 {
     x->x_threshold = t;
+    nlcubic_update(x);
 }
 
 static void nlcubic_coef(t_nlcubic *x, t_floatarg a1, t_floatarg a2, t_floatarg a3)
@@ -90,6 +150,56 @@ static void nlcubic_coef(t_nlcubic *x, t_floatarg a1, t_floatarg a2, t_floatarg
     x->x_a1 = a1;
     x->x_a2 = a2;
     x->x_a3 = a3;
+    nlcubic_update(x);
+}
+
+static void nlcubic_adaa(t_nlcubic *x, t_floatarg f)
+{
+    int order = (int)f;
+    if (order < 0 || order > 2) {
+        error("adaa: the order must be 0, 1 or 2");
+        return;
+    }
+    x->x_adaa.order(order);
+}
+
+static void nlcubic_oversample(t_nlcubic *x, t_symbol *, int argc, t_atom *argv)
+{
+    int factor = (argc > 0) ? (int)atom_getfloat(&argv[0]) : 1;
+    t_symbol *mode = (argc > 1) ? atom_getsymbol(&argv[1]) : gensym("linear");
+    if (argc > 2 || (factor != 1 && factor != 2 && factor != 4 && factor != 8)) {
+        error("oversample: the factor must be 1, 2, 4 or 8");
+        return;
+    }
+    if (mode != gensym("linear") && mode != gensym("minimum")) {
+        error("oversample: the mode must be linear or minimum");
+        return;
+    }
+
+    oversampler_mode osmode = (mode == gensym("linear")) ?
+        oversampler_linear : oversampler_minimum;
+    try {
+        if (x->x_os.mode() != osmode)
+            x->x_os = oversampler<t_float, 8>(osmode, x->x_blocksize);
+    }
+    catch (std::exception &ex) {
+        error("%s", ex.what());
+        return;
+    }
+    x->x_osfactor = factor;
+    x->x_osmode = osmode;
+    x->x_os.factor(factor);
+    x->x_adaa.reset();
+}
+
+// output the delay of the oversampling and the antialiasing, in milliseconds
+static void nlcubic_latency(t_nlcubic *x)
+{
+    const t_float fs = sys_getsr();
+    f64 latency = x->x_os.latency() + 0.5 * x->x_adaa.order() / x->x_osfactor;
+    t_atom msg;
+    SETFLOAT(&msg, 1e3 * latency / fs);
+    outlet_anything(x->x_otl_info.get(), gensym("latency"), 1, &msg);
 }
 
 PDEX_API
@@ -108,4 +218,13 @@ void nlcubic_tilde_setup()
     class_addmethod(
         cls, (t_method)&nlcubic_coef, gensym("coef"),
         A_DEFFLOAT, A_DEFFLOAT, A_DEFFLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&nlcubic_adaa, gensym("adaa"),
+        A_FLOAT, A_NULL);
+    class_addmethod(
+        cls, (t_method)&nlcubic_oversample, gensym("oversample"),
+        A_GIMME, A_NULL);
+    class_addmethod(
+        cls, (t_method)&nlcubic_latency, gensym("latency"),
+        A_NULL);
 }
@@ -7,6 +7,7 @@
 #include "util/filter/filter.h"
 #include <jsl/dynarray>
 #include <jsl/types>
+#include <complex>
 
 // IIR Direct Form I processor
 template <class R>
@@ -21,6 +22,28 @@ private:
     jsl::dynarray<R> x, y;
 };
 
+// IIR cascade of second order sections, transposed Direct Form II
+template <class R>
+struct iir_sos_t {
+    iir_sos_t() noexcept {}
+    explicit iir_sos_t(const pzk_t<R> &pzk);
+    explicit iir_sos_t(const coef_t<R> &c);
+    R tick(R in);
+    // process a block, pipelined across sections (in-place allowed)
+    void process(const R *in, R *out, uint n);
+    void reset();
+    uint sections() const noexcept
+        { return ns; }
+    // number of sections which run in parallel
+    enum { lanes = 4 };
+private:
+    uint ns = 0;
+    // groups of lanes, each made of rows: b0 b1 b2 a1 a2 z1 z2
+    jsl::dynarray<R> s;
+    enum { row_b0, row_b1, row_b2, row_a1, row_a2,
+           row_z1, row_z2, row_count };
+};
+
 // FIR Direct Form I processor
 template <class R>
 struct fir_t {
@@ -44,4 +67,9 @@ u32 fastrandom(u32 *pseed);
 template <class R>
 R white(u32 *pseed);
 
+//------------------------------------------------------------------------------
+// magnitudes of complex numbers, without the care for overflow of std::abs
+template <class R>
+void magnitude(const std::complex<R> *in, R *out, uint n);
+
 #include "util/dsp.tcc"
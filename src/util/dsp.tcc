@@ -6,6 +6,8 @@
 #include "util/dsp.h"
 #include <jsl/math>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 template <class R>
 iir_t<R>::iir_t(const coef_t<R> &c)
@@ -45,6 +47,188 @@ R iir_t<R>::tick(R in)
     return r;
 }
 
+//------------------------------------------------------------------------------
+namespace dsp_detail {
+
+// group roots into real factors (1 + c1 z^-1 + c2 z^-2), return the count
+template <class R>
+uint sos_factors(const jsl::dynarray<std::complex<R>> &r, R *c1, R *c2)
+{
+    const R tol = std::sqrt(std::numeric_limits<R>::epsilon());
+    uint nf = 0;
+
+    // complex conjugate pairs, one of each
+    for (const std::complex<R> &x : r) {
+        if (x.imag() > tol * std::max<R>(1, std::abs(x))) {
+            c1[nf] = -2 * x.real();
+            c2[nf] = std::norm(x);
+            ++nf;
+        }
+    }
+    // real roots, two by two
+    bool odd = false;
+    for (const std::complex<R> &x : r) {
+        if (std::fabs(x.imag()) <= tol * std::max<R>(1, std::abs(x))) {
+            if (!odd) {
+                c1[nf] = -x.real();
+                c2[nf] = 0;
+            }
+            else {
+                c2[nf] = -c1[nf] * x.real();
+                c1[nf] -= x.real();
+                ++nf;
+            }
+            odd = !odd;
+        }
+    }
+    nf += odd;
+    return nf;
+}
+
+// process a group of sections in a pipeline, section k computing sample t-k
+// at step t; the pipeline fills and drains within the block.
+template <class R, uint L>
+void sos_pipeline(R *g, const R *in, R *out, uint n)
+{
+    enum { row_b0, row_b1, row_b2, row_a1, row_a2, row_z1, row_z2 };
+    R b0[L], b1[L], b2[L], a1[L], a2[L], z1[L], z2[L];
+    // input of each section, and output of the last
+    R u[L + 1] = {};
+
+    // local copies, not aliased with the signals
+    std::copy_n(&g[row_b0 * L], L, b0);
+    std::copy_n(&g[row_b1 * L], L, b1);
+    std::copy_n(&g[row_b2 * L], L, b2);
+    std::copy_n(&g[row_a1 * L], L, a1);
+    std::copy_n(&g[row_a2 * L], L, a2);
+    std::copy_n(&g[row_z1 * L], L, z1);
+    std::copy_n(&g[row_z2 * L], L, z2);
+
+    // step the sections from last to first, each passing its result to the
+    // next; sections outside the range keep their state, and their results
+    // are never used. indices are constant once unrolled, so that the arrays
+    // can live in registers.
+    auto step = [&](uint k0, uint k1) {
+#pragma GCC unroll 16
+        for (uint j = 0; j < L; ++j) {
+            const uint k = L - 1 - j;
+            R x = u[k];
+            R r = b0[k] * x + z1[k];
+            R s1 = b1[k] * x - a1[k] * r + z2[k];
+            R s2 = b2[k] * x - a2[k] * r;
+            bool active = k >= k0 && k < k1;
+            z1[k] = active ? s1 : z1[k];
+            z2[k] = active ? s2 : z2[k];
+            u[k + 1] = r;
+        }
+    };
+
+    uint t = 0;
+    uint nt = n + L - 1;
+    // fill
+    for (; t < L - 1 && t < n; ++t) {
+        u[0] = in[t];
+        step(0, t + 1);
+    }
+    // full
+    for (; t < n; ++t) {
+        u[0] = in[t];
+        step(0, L);
+        out[t - (L - 1)] = u[L];
+    }
+    // drain
+    for (; t < nt; ++t) {
+        uint k0 = (t < n) ? 0 : (t - n + 1);
+        uint k1 = (t < L) ? (t + 1) : L;
+        u[0] = (t < n) ? in[t] : 0;
+        step(k0, k1);
+        if (t >= L - 1)
+            out[t - (L - 1)] = u[L];
+    }
+
+    std::copy_n(z1, L, &g[row_z1 * L]);
+    std::copy_n(z2, L, &g[row_z2 * L]);
+}
+
+}  // namespace dsp_detail
+
+template <class R>
+iir_sos_t<R>::iir_sos_t(const pzk_t<R> &pzk)
+{
+    uint np = pzk.p.size(), nz = pzk.z.size();
+    uint nmax = std::max<uint>(1, std::max(np, nz));
+
+    jsl::dynarray<R> pc1(nmax, 0), pc2(nmax, 0), zc1(nmax, 0), zc2(nmax, 0);
+    uint npf = dsp_detail::sos_factors(pzk.p, pc1.data(), pc2.data());
+    uint nzf = dsp_detail::sos_factors(pzk.z, zc1.data(), zc2.data());
+    uint ns = std::max<uint>(1, std::max(npf, nzf));
+    uint ngroups = (ns + lanes - 1) / lanes;
+
+    this->ns = ns;
+    this->s.reset(ngroups * row_count * lanes);
+    this->s.fill(0);
+
+    // unused lanes of the last group are identity sections
+    R *s = this->s.data();
+    for (uint k = 0; k < ngroups * lanes; ++k) {
+        R *g = &s[(k / lanes) * row_count * lanes];
+        uint l = k % lanes;
+        R gain = (k == 0) ? pzk.k : 1;
+        g[row_b0 * lanes + l] = gain;
+        if (k < ns) {
+            g[row_b1 * lanes + l] = gain * zc1[k];
+            g[row_b2 * lanes + l] = gain * zc2[k];
+            g[row_a1 * lanes + l] = pc1[k];
+            g[row_a2 * lanes + l] = pc2[k];
+        }
+    }
+}
+
+template <class R>
+iir_sos_t<R>::iir_sos_t(const coef_t<R> &c)
+    : iir_sos_t(c.pzk())
+{
+}
+
+template <class R>
+void iir_sos_t<R>::reset()
+{
+    R *s = this->s.data();
+    for (uint i = 0, n = this->s.size(); i < n; i += row_count * lanes)
+        std::fill(&s[i + row_z1 * lanes], &s[i + row_count * lanes], 0);
+}
+
+template <class R>
+R iir_sos_t<R>::tick(R in)
+{
+    const uint ns = this->ns;
+    R *s = this->s.data();
+
+    for (uint k = 0; k < ns; ++k) {
+        R *g = &s[(k / lanes) * row_count * lanes];
+        uint l = k % lanes;
+        R &z1 = g[row_z1 * lanes + l], &z2 = g[row_z2 * lanes + l];
+        R r = g[row_b0 * lanes + l] * in + z1;
+        z1 = g[row_b1 * lanes + l] * in - g[row_a1 * lanes + l] * r + z2;
+        z2 = g[row_b2 * lanes + l] * in - g[row_a2 * lanes + l] * r;
+        in = r;
+    }
+    return in;
+}
+
+template <class R>
+void iir_sos_t<R>::process(const R *in, R *out, uint n)
+{
+    R *s = this->s.data();
+    // the last group is completed by identity sections
+    const uint ngroups = (this->ns + lanes - 1) / lanes;
+
+    for (uint i = 0; i < ngroups; ++i) {
+        dsp_detail::sos_pipeline<R, lanes>(&s[i * row_count * lanes], in, out, n);
+        in = out;
+    }
+}
+
 //------------------------------------------------------------------------------
 template <class R>
 fir_t<R>::fir_t(const jsl::dynarray<R> &c)
@@ -107,3 +291,17 @@ inline R white(u32 *pseed)
 {
     return (i32)fastrandom(pseed) * (1 / (R)INT32_MAX);
 }
+
+//------------------------------------------------------------------------------
+template <class R>
+inline void magnitude(const std::complex<R> *in, R *out, uint n)
+{
+    // the layout of complex is the array of real and imaginary
+    const R *ri = reinterpret_cast<const R *>(in);
+#pragma omp simd
+    for (uint i = 0; i < n; ++i) {
+        R re = ri[2 * i];
+        R im = ri[2 * i + 1];
+        out[i] = std::sqrt(re * re + im * im);
+    }
+}
@@ -0,0 +1,95 @@
+/* Antiderivative antialiasing of memoryless nonlinearities
+ *
+ * References
+ *     Parker, J., Zavalishin, V., & Le Bivic, E. (2016, September).
+ *     Reducing the aliasing of nonlinear waveshaping using continuous-time
+ *     convolution.
+ *     Bilbao, S., Esqueda, F., Parker, J., & Välimäki, V. (2017).
+ *     Antiderivative antialiasing for memoryless nonlinearities.
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/types>
+
+// a cubic polynomial clipped to plus or minus a threshold, with its first
+// and second antiderivatives, which are zero at the origin. the function
+// is polynomial between the points where the clipping starts or ends.
+template <class R>
+class clipped_cubic {
+public:
+    // coefficients in ascending order, threshold infinite for no clipping
+    void set(const R coef[4], R threshold);
+
+    R f0(R x) const;
+    R f1(R x) const;
+    R f2(R x) const;
+
+    // the same over a block of inputs, `x` and `y` not overlapping
+    void f0(const R *x, R *y, uint n) const;
+    void f1(const R *x, R *y, uint n) const;
+    void f2(const R *x, R *y, uint n) const;
+
+private:
+    enum { maxbreaks = 6 };
+    struct segment {
+        R p0[4];
+        R p1[5];
+        R p2[6];
+        // constant, such that the antiderivatives are of degree 1 and 2
+        bool clipped;
+    };
+
+    uint find(R x) const;
+    // a piecewise polynomial, the coefficients of each piece at `p`
+    template <uint N> void eval(R (segment::*p)[N], const R *x, R *y, uint n) const;
+    // a piece of degree below M, where the input passes the break if any
+    template <uint M> static void piece(const R *c, const R *b, const R *x, R *y, uint n);
+
+private:
+    uint nbreaks_ = 0;
+    R breaks_[maxbreaks] = {};
+    segment seg_[maxbreaks + 1] = {};
+};
+
+// the output of a function by antiderivative antialiasing, of order 0 to 2,
+// the function having the antiderivatives f1 and f2. the output is delayed
+// by half a sample at order 1, and by one sample at order 2. after a reset,
+// the past inputs are zero, where the antiderivatives are taken to be zero.
+template <class R>
+class adaa {
+public:
+    // set the order, and clear
+    void order(uint order);
+    uint order() const
+        { return order_; }
+
+    template <class F> R process(const F &fn, R x);
+    // the same over a block of samples of any type, `fn` also taking blocks
+    // of inputs; `in` and `out` may be the same
+    template <class F, class T> void process(const F &fn, const T *in, T *out, uint n);
+
+    // compute again the values kept from the past inputs, after a change of
+    // the function
+    template <class F> void update(const F &fn);
+
+    void reset();
+
+private:
+    template <class F> static R near2(const F &fn, R x0, R x1, R x2);
+
+private:
+    // samples processed at once, by the block variant
+    enum { chunk = 128 };
+    uint order_ = 0;
+    // past inputs
+    R x1_ = 0;
+    R x2_ = 0;
+    // antiderivative at the last input, and divided difference of the
+    // second antiderivative over the last two inputs
+    R f1_ = 0;
+    R d1_ = 0;
+};
+
+#include "util/dsp/adaa.tcc"
@@ -0,0 +1,469 @@
+#include "util/dsp/adaa.h"
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+#include <cstring>
+
+namespace adaa_detail {
+
+template <class R>
+R polyval(const R *p, uint n, R x)
+{
+    R y = 0;
+    for (uint i = n; i-- > 0;)
+        y = y * x + p[i];
+    return y;
+}
+
+// the same of a constant size, unrolled to vectorize the loops around
+template <uint N, class R>
+R polyval(const R *p, R x)
+{
+    R y = 0;
+#pragma GCC unroll 8
+    for (uint j = 0; j < N; ++j)
+        y = y * x + p[N - 1 - j];
+    return y;
+}
+
+// `a` if `x >= b`, otherwise `c`, taken by the sign of the difference; the
+// compiler does not vectorize a select on a comparison, which may trap
+template <class R>
+R select_ge(R x, R b, R a, R c)
+{
+    typedef typename std::conditional<sizeof(R) == 8, u64, u32>::type U;
+    R d = x - b;
+    U ud, ua, uc;
+    std::memcpy(&ud, &d, sizeof(R));
+    std::memcpy(&ua, &a, sizeof(R));
+    std::memcpy(&uc, &c, sizeof(R));
+    U mask = -(ud >> (8 * sizeof(R) - 1));
+    U uy = (ua & ~mask) | (uc & mask);
+    R y;
+    std::memcpy(&y, &uy, sizeof(R));
+    return y;
+}
+
+// a root of the monotonic polynomial in [a, b], where it changes sign
+template <class R>
+R bisect(const R *p, uint n, R a, R b)
+{
+    bool rising = polyval(p, n, a) < 0;
+    for (uint i = 0; i < 200; ++i) {
+        R m = (a + b) / 2;
+        if (m == a || m == b)
+            break;
+        ((polyval(p, n, m) < 0) == rising) ? (a = m) : (b = m);
+    }
+    return (a + b) / 2;
+}
+
+// the real roots of a polynomial of degree at most 3, found in the
+// intervals where it is monotonic, in increasing order
+template <class R>
+uint roots(const R p[4], R *r)
+{
+    // the turning points, zeros of the derivative
+    R c[2];
+    uint nc = 0;
+    if (p[3] != 0) {
+        R disc = p[2] * p[2] - 3 * p[3] * p[1];
+        if (disc > 0) {
+            R sq = std::sqrt(disc);
+            c[0] = (-p[2] - sq) / (3 * p[3]);
+            c[1] = (-p[2] + sq) / (3 * p[3]);
+            if (c[0] > c[1])
+                std::swap(c[0], c[1]);
+            nc = 2;
+        }
+    }
+    else if (p[2] != 0)
+        c[nc++] = -p[1] / (2 * p[2]);
+
+    // bounds of the intervals, those at the ends found by expanding
+    R bounds[4];
+    uint nb = 0;
+    R first = (nc > 0) ? c[0] : 0;
+    R last = (nc > 0) ? c[nc - 1] : 0;
+    for (R step = 1; ; step *= 2) {
+        R x = first - step;
+        if ((polyval(p, 4, x) < 0) != (polyval(p, 4, first) < 0) || step > (R)1e30) {
+            bounds[nb++] = x;
+            break;
+        }
+    }
+    std::copy(c, c + nc, &bounds[nb]);
+    nb += nc;
+    if (nc == 0)
+        bounds[nb++] = first;
+    for (R step = 1; ; step *= 2) {
+        R x = last + step;
+        if ((polyval(p, 4, x) < 0) != (polyval(p, 4, last) < 0) || step > (R)1e30) {
+            bounds[nb++] = x;
+            break;
+        }
+    }
+
+    uint nr = 0;
+    for (uint i = 0; i + 1 < nb; ++i) {
+        R a = bounds[i], b = bounds[i + 1];
+        R ya = polyval(p, 4, a), yb = polyval(p, 4, b);
+        if (ya == 0)
+            r[nr++] = a;
+        else if ((ya < 0) != (yb < 0) && yb != 0)
+            r[nr++] = bisect(p, 4, a, b);
+    }
+    R yb = polyval(p, 4, bounds[nb - 1]);
+    if (yb == 0)
+        r[nr++] = bounds[nb - 1];
+    return nr;
+}
+
+}  // namespace adaa_detail
+
+template <class R>
+void clipped_cubic<R>::set(const R coef[4], R threshold)
+{
+    using adaa_detail::polyval;
+    using adaa_detail::roots;
+
+    Expects(threshold >= 0);
+
+    // the points where the polynomial crosses the threshold
+    uint nbreaks = 0;
+    R *breaks = breaks_;
+    if (std::isfinite(threshold)) {
+        for (R t : {threshold, -threshold}) {
+            R p[4] = {coef[0] - t, coef[1], coef[2], coef[3]};
+            if (p[1] == 0 && p[2] == 0 && p[3] == 0)
+                continue;
+            nbreaks += roots(p, &breaks[nbreaks]);
+        }
+        std::sort(breaks, breaks + nbreaks);
+        nbreaks = std::unique(breaks, breaks + nbreaks) - breaks;
+    }
+    nbreaks_ = nbreaks;
+
+    // the pieces of the function, clipped or not
+    for (uint k = 0; k < nbreaks + 1; ++k) {
+        segment &seg = seg_[k];
+        R mid;
+        if (nbreaks == 0)
+            mid = 0;
+        else if (k == 0)
+            mid = breaks[0] - 1;
+        else if (k == nbreaks)
+            mid = breaks[nbreaks - 1] + 1;
+        else
+            mid = (breaks[k - 1] + breaks[k]) / 2;
+        R y = polyval(coef, 4, mid);
+        seg.clipped = std::isfinite(threshold) && std::fabs(y) > threshold;
+        if (seg.clipped) {
+            std::fill_n(seg.p0, 4, 0);
+            seg.p0[0] = (y > 0) ? threshold : -threshold;
+        }
+        else
+            std::copy_n(coef, 4, seg.p0);
+    }
+
+    // the antiderivatives, continuous at the breaks
+    for (uint k = 0; k < nbreaks + 1; ++k) {
+        segment &seg = seg_[k];
+        seg.p1[0] = 0;
+        for (uint i = 0; i < 4; ++i)
+            seg.p1[i + 1] = seg.p0[i] / (i + 1);
+        if (k > 0) {
+            R b = breaks[k - 1];
+            seg.p1[0] = polyval(seg_[k - 1].p1, 5, b) - polyval(seg.p1, 5, b);
+        }
+    }
+    R origin1 = f1(0);
+    for (uint k = 0; k < nbreaks + 1; ++k)
+        seg_[k].p1[0] -= origin1;
+
+    for (uint k = 0; k < nbreaks + 1; ++k) {
+        segment &seg = seg_[k];
+        seg.p2[0] = 0;
+        for (uint i = 0; i < 5; ++i)
+            seg.p2[i + 1] = seg.p1[i] / (i + 1);
+        if (k > 0) {
+            R b = breaks[k - 1];
+            seg.p2[0] = polyval(seg_[k - 1].p2, 6, b) - polyval(seg.p2, 6, b);
+        }
+    }
+    R origin2 = f2(0);
+    for (uint k = 0; k < nbreaks + 1; ++k)
+        seg_[k].p2[0] -= origin2;
+}
+
+template <class R>
+uint clipped_cubic<R>::find(R x) const
+{
+    // the breaks are sorted, count those which are passed
+    uint k = 0;
+    for (uint i = 0, n = nbreaks_; i < n; ++i)
+        k += x >= breaks_[i];
+    return k;
+}
+
+template <class R>
+template <uint N>
+void clipped_cubic<R>::eval(R (segment::*p)[N], const R *x, R *y, uint n) const
+{
+    // each piece over all the block, kept where the input passes its break,
+    // so that the loops have no branch; the clipped pieces are of lower
+    // degree, and cheaper
+    for (uint k = 0, nk = nbreaks_ + 1; k < nk; ++k) {
+        const segment &seg = seg_[k];
+        const R *b = (k > 0) ? &breaks_[k - 1] : nullptr;
+        if (seg.clipped)
+            piece<N - 3>(seg.*p, b, x, y, n);
+        else
+            piece<N>(seg.*p, b, x, y, n);
+    }
+}
+
+template <class R>
+template <uint M>
+void clipped_cubic<R>::piece(const R *c, const R *b, const R *x, R *y, uint n)
+{
+    using adaa_detail::polyval;
+    using adaa_detail::select_ge;
+
+    if (!b) {
+#pragma omp simd
+        for (uint i = 0; i < n; ++i)
+            y[i] = polyval<M>(c, x[i]);
+    }
+    else {
+        const R bk = *b;
+#pragma omp simd
+        for (uint i = 0; i < n; ++i) {
+            R v = polyval<M>(c, x[i]);
+            y[i] = select_ge(x[i], bk, v, y[i]);
+        }
+    }
+}
+
+template <class R>
+R clipped_cubic<R>::f0(R x) const
+{
+    return adaa_detail::polyval(seg_[find(x)].p0, 4, x);
+}
+
+template <class R>
+R clipped_cubic<R>::f1(R x) const
+{
+    return adaa_detail::polyval(seg_[find(x)].p1, 5, x);
+}
+
+template <class R>
+R clipped_cubic<R>::f2(R x) const
+{
+    return adaa_detail::polyval(seg_[find(x)].p2, 6, x);
+}
+
+template <class R>
+void clipped_cubic<R>::f0(const R *x, R *y, uint n) const
+{
+    eval(&segment::p0, x, y, n);
+}
+
+template <class R>
+void clipped_cubic<R>::f1(const R *x, R *y, uint n) const
+{
+    eval(&segment::p1, x, y, n);
+}
+
+template <class R>
+void clipped_cubic<R>::f2(const R *x, R *y, uint n) const
+{
+    eval(&segment::p2, x, y, n);
+}
+
+//------------------------------------------------------------------------------
+template <class R>
+void adaa<R>::order(uint order)
+{
+    Expects(order <= 2);
+    order_ = order;
+    reset();
+}
+
+template <class R>
+template <class F>
+R adaa<R>::process(const F &fn, R x0)
+{
+    // below which a difference of inputs is too small to divide by
+    const R eps = 1e-5;
+
+    switch (order_) {
+    default:
+        return fn.f0(x0);
+
+    case 1: {
+        R x1 = x0 - x1_;
+        R f1 = fn.f1(x0);
+        R y = (std::fabs(x1) > eps) ?
+            ((f1 - f1_) / x1) : fn.f0((x0 + x1_) / 2);
+        x1_ = x0;
+        f1_ = f1;
+        return y;
+    }
+
+    case 2: {
+        const R x1 = x1_;
+        const R x2 = x2_;
+        R f2 = fn.f2(x0);
+        R d1 = (std::fabs(x0 - x1) > eps) ?
+            ((f2 - f1_) / (x0 - x1)) : fn.f1((x0 + x1) / 2);
+        R y = (std::fabs(x0 - x2) > eps) ?
+            (2 * (d1 - d1_) / (x0 - x2)) : near2(fn, x0, x1, x2);
+        x2_ = x1;
+        x1_ = x0;
+        f1_ = f2;
+        d1_ = d1;
+        return y;
+    }
+    }
+}
+
+template <class R>
+template <class F, class T>
+void adaa<R>::process(const F &fn, const T *in, T *out, uint n)
+{
+    const R eps = 1e-5;
+
+    // the antiderivatives over all the chunk, then their differences; the
+    // differences of inputs too small to divide by are done again after
+    for (uint i0 = 0; i0 < n; i0 += chunk) {
+        const uint m = std::min<uint>(chunk, n - i0);
+        const T *src = in + i0;
+        T *dst = out + i0;
+
+        if (order_ == 0) {
+            R x[chunk];
+            R y[chunk];
+            std::copy_n(src, m, x);
+            fn.f0(x, y, m);
+            std::copy_n(y, m, dst);
+        }
+        else if (order_ == 1) {
+            // inputs and antiderivatives, preceded by the last
+            R x[chunk + 1];
+            R f[chunk + 1];
+            x[0] = x1_;
+            f[0] = f1_;
+            std::copy_n(src, m, &x[1]);
+            fn.f1(&x[1], &f[1], m);
+
+            uint near = 0;
+#pragma omp simd reduction(+: near)
+            for (uint i = 0; i < m; ++i) {
+                R dx = x[i + 1] - x[i];
+                bool far = std::fabs(dx) > eps;
+                dst[i] = (f[i + 1] - f[i]) / (far ? dx : 1);
+                near += !far;
+            }
+            for (uint i = 0; near > 0 && i < m; ++i) {
+                if (!(std::fabs(x[i + 1] - x[i]) > eps)) {
+                    dst[i] = fn.f0((x[i + 1] + x[i]) / 2);
+                    --near;
+                }
+            }
+
+            x1_ = x[m];
+            f1_ = f[m];
+        }
+        else {
+            // inputs preceded by the last two, the second antiderivatives
+            // and the divided differences preceded by the last
+            R x[chunk + 2];
+            R f[chunk + 1];
+            R d[chunk + 1];
+            x[0] = x2_;
+            x[1] = x1_;
+            f[0] = f1_;
+            d[0] = d1_;
+            std::copy_n(src, m, &x[2]);
+            fn.f2(&x[2], &f[1], m);
+
+            uint near = 0;
+#pragma omp simd reduction(+: near)
+            for (uint i = 0; i < m; ++i) {
+                R dx = x[i + 2] - x[i + 1];
+                bool far = std::fabs(dx) > eps;
+                d[i + 1] = (f[i + 1] - f[i]) / (far ? dx : 1);
+                near += !far;
+            }
+            for (uint i = 0; near > 0 && i < m; ++i) {
+                if (!(std::fabs(x[i + 2] - x[i + 1]) > eps)) {
+                    d[i + 1] = fn.f1((x[i + 2] + x[i + 1]) / 2);
+                    --near;
+                }
+            }
+
+            near = 0;
+#pragma omp simd reduction(+: near)
+            for (uint i = 0; i < m; ++i) {
+                R dx = x[i + 2] - x[i];
+                bool far = std::fabs(dx) > eps;
+                dst[i] = 2 * (d[i + 1] - d[i]) / (far ? dx : 1);
+                near += !far;
+            }
+            for (uint i = 0; near > 0 && i < m; ++i) {
+                if (!(std::fabs(x[i + 2] - x[i]) > eps)) {
+                    dst[i] = near2(fn, x[i + 2], x[i + 1], x[i]);
+                    --near;
+                }
+            }
+
+            x2_ = x[m];
+            x1_ = x[m + 1];
+            f1_ = f[m];
+            d1_ = d[m];
+        }
+    }
+}
+
+// the output of order 2, when the inputs around the last are the same
+template <class R>
+template <class F>
+R adaa<R>::near2(const F &fn, R x0, R x1, R x2)
+{
+    const R eps = 1e-5;
+
+    R xbar = (x0 + x2) / 2;
+    R delta = xbar - x1;
+    if (std::fabs(delta) > eps)
+        return 2 / delta * (fn.f1(xbar) + (fn.f2(x1) - fn.f2(xbar)) / delta);
+    else
+        return fn.f0((xbar + x1) / 2);
+}
+
+template <class R>
+template <class F>
+void adaa<R>::update(const F &fn)
+{
+    const R eps = 1e-5;
+
+    switch (order_) {
+    case 1:
+        f1_ = fn.f1(x1_);
+        break;
+    case 2:
+        f1_ = fn.f2(x1_);
+        d1_ = (std::fabs(x1_ - x2_) > eps) ?
+            ((f1_ - fn.f2(x2_)) / (x1_ - x2_)) : fn.f1((x1_ + x2_) / 2);
+        break;
+    }
+}
+
+template <class R>
+void adaa<R>::reset()
+{
+    // the antiderivatives are zero at the origin
+    x1_ = x2_ = 0;
+    f1_ = d1_ = 0;
+}
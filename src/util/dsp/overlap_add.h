@@ -12,10 +12,18 @@ class overlap_add {
 public:
     overlap_add() noexcept {}
     overlap_add(size_t step, gsl::span<const R> window);
+    // for frames of any size, at any steps, up to `maxsize` both
+    explicit overlap_add(size_t maxsize);
 
     // compute one block of overlap-add
     void process(const R *in/*[winsize]*/, R *out/*[step]*/);
 
+    // add a frame multiplied by the window and the gain, which begins
+    // `delay` samples after the next output
+    void add(const R *in, const R *window, size_t size, size_t delay, R gain = 1);
+    // take the next `n` samples of output, which no frame added later covers
+    void read(R *out, size_t n);
+
     const size_t step() const
         { return step_; }
 
@@ -25,7 +33,10 @@ public:
 private:
     size_t step_ = 0;
     jsl::dynarray<R> window_;
+    // sum of the frames, circular, starting at the next output
     jsl::dynarray<R> buffer_;
+    size_t bufmask_ = 0;
+    size_t bufidx_ = 0;
 };
 
 #include "util/dsp/overlap_add.tcc"
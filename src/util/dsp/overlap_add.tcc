@@ -4,27 +4,63 @@
 
 template <class R>
 overlap_add<R>::overlap_add(size_t step, gsl::span<const R> window)
+    : overlap_add(window.size())
 {
     size_t winsize = window.size();
     Ensures(step < winsize);
     step_ = step;
     window_.assign(window.begin(), window.end());
-    buffer_.reset(winsize);
+}
+
+template <class R>
+overlap_add<R>::overlap_add(size_t maxsize)
+{
+    // room for a frame after the longest step, in a power of two
+    size_t size = 1;
+    while (size < 2 * maxsize)
+        size <<= 1;
+    buffer_.reset(size);
+    buffer_.fill(0);
+    bufmask_ = size - 1;
 }
 
 template <class R>
 void overlap_add<R>::process(const R *in, R *out)
 {
-    size_t step = step_;
-    size_t winsize = window_.size();
-    R *window = window_.data();
-    R *buffer = buffer_.data();
+    read(out, step_);
+    add(in, window_.data(), window_.size(), 0);
+}
 
-    std::copy(&buffer[0], &buffer[step], &out[0]);
-    std::move(&buffer[step], &buffer[winsize], &buffer[0]);
-    std::fill(&buffer[winsize - step], &buffer[winsize], 0);
+template <class R>
+void overlap_add<R>::add(const R *in, const R *window, size_t size, size_t delay, R gain)
+{
+    R *buffer = buffer_.data();
+    const size_t bufsize = bufmask_ + 1;
+    Expects(delay + size <= bufsize);
 
+    // in two parts around the end of the buffer
+    const size_t start = (bufidx_ + delay) & bufmask_;
+    const size_t n1 = std::min(size, bufsize - start);
+#pragma omp simd
+    for (size_t i = 0; i < n1; ++i)
+        buffer[start + i] += gain * window[i] * in[i];
 #pragma omp simd
-    for (size_t i = 0; i < winsize; ++i)
-        buffer[i] += window[i] * in[i];
+    for (size_t i = n1; i < size; ++i)
+        buffer[i - n1] += gain * window[i] * in[i];
+}
+
+template <class R>
+void overlap_add<R>::read(R *out, size_t n)
+{
+    R *buffer = buffer_.data();
+    const size_t bufsize = bufmask_ + 1;
+    size_t bufidx = bufidx_;
+
+    // take the completed samples, and free their place for the next frames
+    size_t n1 = std::min(n, bufsize - bufidx);
+    std::copy(&buffer[bufidx], &buffer[bufidx + n1], &out[0]);
+    std::fill(&buffer[bufidx], &buffer[bufidx + n1], 0);
+    std::copy(&buffer[0], &buffer[n - n1], &out[n1]);
+    std::fill(&buffer[0], &buffer[n - n1], 0);
+    bufidx_ = (bufidx + n) & bufmask_;
 }
@@ -0,0 +1,93 @@
+/* Oversampling by cascaded half-band filters
+ *
+ * The IIR half-band is the polyphase allpass structure of Laurent de Soras'
+ * HIIR library, which is in the public domain.
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/dynarray>
+#include <jsl/types>
+
+enum oversampler_mode {
+    // FIR half-bands, symmetric, with a constant delay
+    oversampler_linear,
+    // IIR half-bands, of two paths of allpass, with a short delay which
+    // depends on the frequency, as a filter of minimum phase
+    oversampler_minimum,
+};
+
+// stage which doubles or halves the rate, by a filter of cutoff at a quarter
+// of the higher rate, computing in each direction the polyphase branches
+template <class R>
+class halfband {
+public:
+    halfband() noexcept {}
+    // the order is the number of FIR taps of the branch, divided by 2, or
+    // the number of coefficients of the IIR
+    halfband(oversampler_mode mode, uint order, f64 transition);
+
+    // produce 2*n outputs of n inputs
+    void up(const R *in, R *out, uint n);
+    // produce n outputs of 2*n inputs
+    void down(const R *in, R *out, uint n);
+    void reset();
+
+    // delay in one direction, in samples of the higher rate, at low
+    // frequencies
+    f64 latency() const;
+
+private:
+    oversampler_mode mode_ = oversampler_linear;
+    uint order_ = 0;
+    jsl::dynarray<R> coef_;
+    // FIR: histories stored twice, contiguous from any position
+    //      inputs of up, even and odd inputs of down
+    // IIR: inputs and outputs of the allpass, of up then of down
+    jsl::dynarray<R> state_;
+    uint upidx_ = 0;
+    uint downidx_ = 0;
+};
+
+// upsampler and downsampler by a power of 2, up to `Factor`. the processing
+// at the higher rate is made between the calls to `up` and `down`, in the
+// buffer which is given by `up`.
+template <class R, uint Factor>
+class oversampler {
+public:
+    static_assert(Factor == 2 || Factor == 4 || Factor == 8,
+                  "the factor must be 2, 4 or 8");
+    enum { maxstages = (Factor == 2) ? 1 : (Factor == 4) ? 2 : 3 };
+
+    oversampler() noexcept {}
+    oversampler(oversampler_mode mode, uint maxblock);
+
+    // set the factor, a power of 2 not above `Factor`, and clear
+    void factor(uint factor);
+    uint factor() const
+        { return 1u << nstages_; }
+    oversampler_mode mode() const
+        { return mode_; }
+
+    // upsample n inputs, into the buffer of n*factor samples which is returned
+    R *up(const R *in, uint n);
+    // downsample the buffer which `up` returned into n outputs
+    void down(R *out, uint n);
+
+    void reset();
+
+    // delay of the round trip, in samples of the base rate, at low
+    // frequencies
+    f64 latency() const;
+
+private:
+    oversampler_mode mode_ = oversampler_linear;
+    uint maxblock_ = 0;
+    uint nstages_ = 0;
+    halfband<R> stages_[maxstages];
+    // alternate buffers of the stages, of the block at the highest rate
+    jsl::dynarray<R> buffer_[2];
+};
+
+#include "util/dsp/oversampler.tcc"
@@ -0,0 +1,297 @@
+#include "util/dsp/oversampler.h"
+#include "util/filter/design.h"
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <cmath>
+
+namespace oversampler_detail {
+
+// coefficients of the IIR half-band of given order and transition band,
+// relative to the higher rate, by the elliptic design of HIIR
+inline void iir_halfband(f64 *coef, uint order, f64 transition)
+{
+    f64 k = std::tan((1 - transition * 2) * M_PI / 4);
+    k *= k;
+    const f64 kksqrt = std::pow(1 - k * k, 0.25);
+    const f64 e = 0.5 * (1 - kksqrt) / (1 + kksqrt);
+    const f64 e2 = e * e;
+    const f64 e4 = e2 * e2;
+    const f64 q = e * (1 + e4 * (2 + e4 * (15 + 150 * e4)));
+
+    const uint n = order * 2 + 1;
+    for (uint index = 0; index < order; ++index) {
+        const uint c = index + 1;
+        f64 num = 0, den = 0;
+        for (uint i = 0; ; ++i) {
+            f64 term = std::pow(q, (f64)(i * (i + 1))) *
+                std::sin((i * 2 + 1) * c * M_PI / n) * ((i & 1) ? -1 : 1);
+            num += term;
+            if (std::fabs(term) <= 1e-100)
+                break;
+        }
+        for (uint i = 1; ; ++i) {
+            f64 term = std::pow(q, (f64)(i * i)) *
+                std::cos(i * 2 * c * M_PI / n) * ((i & 1) ? -1 : 1);
+            den += term;
+            if (std::fabs(term) <= 1e-100)
+                break;
+        }
+        num *= std::pow(q, 0.25);
+        den += 0.5;
+        const f64 ww = num / den;
+        const f64 wwsq = ww * ww;
+        const f64 x = std::sqrt((1 - wwsq * k) * (1 - wwsq / k)) / (1 + wwsq);
+        coef[index] = (1 - x) / (1 + x);
+    }
+}
+
+// orders and transitions of the successive stages, the first at the base
+// rate having the narrowest transition
+struct stage_design {
+    uint order;
+    f64 transition;
+};
+
+static constexpr stage_design fir_stages[] = {{24, 0}, {8, 0}, {6, 0}};
+static constexpr stage_design iir_stages[] = {{8, 0.06}, {4, 0.2}, {3, 0.3}};
+
+}  // namespace oversampler_detail
+
+template <class R>
+halfband<R>::halfband(oversampler_mode mode, uint order, f64 transition)
+{
+    Expects(order > 0);
+    mode_ = mode;
+    order_ = order;
+
+    switch (mode) {
+    case oversampler_linear: {
+        // windowed sinc of 4*order-1 taps, which is zero at the even
+        // distances from the center, other than the center
+        const uint m = order;
+        const uint ntaps = 4 * m - 1;
+        jsl::dynarray<f64> win(ntaps);
+        for (uint i = 0; i < ntaps; ++i) {
+            f64 u = (f64)i / (ntaps - 1);
+            win[i] = 0.42 - 0.5 * std::cos(2 * M_PI * u) + 0.08 * std::cos(4 * M_PI * u);
+        }
+        jsl::dynarray<f64> h = fir1<f64>(0.25, win);
+        // the taps of the branch, at odd distances from the center, scaled
+        // to a gain of 1/2 which adds to the center
+        coef_.reset(2 * m);
+        f64 sum = 0;
+        for (uint j = 0; j < 2 * m; ++j)
+            sum += h[2 * j];
+        for (uint j = 0; j < 2 * m; ++j)
+            coef_[j] = h[2 * j] * (0.5 / sum);
+        // history of up, even and odd histories of down
+        state_.reset(3 * 4 * m);
+        break;
+    }
+    case oversampler_minimum: {
+        jsl::dynarray<f64> coef(order);
+        oversampler_detail::iir_halfband(coef.data(), order, transition);
+        coef_.assign(coef.begin(), coef.end());
+        state_.reset(4 * order);
+        break;
+    }
+    }
+
+    reset();
+}
+
+template <class R>
+void halfband<R>::up(const R *in, R *out, uint n)
+{
+    const uint order = order_;
+    const R *coef = coef_.data();
+
+    switch (mode_) {
+    case oversampler_linear: {
+        const uint len = 2 * order;
+        R *hist = &state_[0];
+        uint idx = upidx_;
+        for (uint i = 0; i < n; ++i) {
+            hist[idx] = hist[idx + len] = in[i];
+            idx = (idx + 1 == len) ? 0 : (idx + 1);
+            // from the oldest to the newest
+            const R *h = &hist[idx];
+            R y = 0;
+#pragma omp simd reduction(+: y)
+            for (uint j = 0; j < len; ++j)
+                y += coef[j] * h[j];
+            out[2 * i] = 2 * y;
+            out[2 * i + 1] = h[order];
+        }
+        upidx_ = idx;
+        break;
+    }
+    case oversampler_minimum: {
+        R *x = &state_[0];
+        R *y = &state_[order];
+        for (uint i = 0; i < n; ++i) {
+            R s[2] = {in[i], in[i]};
+            for (uint k = 0; k < order; ++k) {
+                R &sk = s[k & 1];
+                R t = (sk - y[k]) * coef[k] + x[k];
+                x[k] = sk;
+                y[k] = t;
+                sk = t;
+            }
+            out[2 * i] = s[0];
+            out[2 * i + 1] = s[1];
+        }
+        break;
+    }
+    }
+}
+
+template <class R>
+void halfband<R>::down(const R *in, R *out, uint n)
+{
+    const uint order = order_;
+    const R *coef = coef_.data();
+
+    switch (mode_) {
+    case oversampler_linear: {
+        const uint len = 2 * order;
+        R *even = &state_[2 * len];
+        R *odd = &state_[4 * len];
+        uint idx = downidx_;
+        for (uint i = 0; i < n; ++i) {
+            even[idx] = even[idx + len] = in[2 * i];
+            odd[idx] = odd[idx + len] = in[2 * i + 1];
+            idx = (idx + 1 == len) ? 0 : (idx + 1);
+            // from the oldest to the newest
+            const R *h = &even[idx];
+            R y = 0;
+#pragma omp simd reduction(+: y)
+            for (uint j = 0; j < len; ++j)
+                y += coef[j] * h[j];
+            out[i] = y + R(0.5) * odd[idx + order - 1];
+        }
+        downidx_ = idx;
+        break;
+    }
+    case oversampler_minimum: {
+        R *x = &state_[2 * order];
+        R *y = &state_[3 * order];
+        for (uint i = 0; i < n; ++i) {
+            R s[2] = {in[2 * i + 1], in[2 * i]};
+            for (uint k = 0; k < order; ++k) {
+                R &sk = s[k & 1];
+                R t = (sk - y[k]) * coef[k] + x[k];
+                x[k] = sk;
+                y[k] = t;
+                sk = t;
+            }
+            out[i] = R(0.5) * (s[0] + s[1]);
+        }
+        break;
+    }
+    }
+}
+
+template <class R>
+void halfband<R>::reset()
+{
+    std::fill(state_.begin(), state_.end(), 0);
+    upidx_ = downidx_ = 0;
+}
+
+template <class R>
+f64 halfband<R>::latency() const
+{
+    switch (mode_) {
+    case oversampler_linear:
+        return 2 * order_ - 1;
+    case oversampler_minimum: {
+        // mean of the delays of the paths, at the frequency zero, less the
+        // half sample between the paths which the other direction takes back
+        f64 delay = 1;
+        for (uint k = 0; k < order_; ++k)
+            delay += 2 * (1 - coef_[k]) / (1 + coef_[k]);
+        return delay / 2 - 0.5;
+    }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+template <class R, uint Factor>
+oversampler<R, Factor>::oversampler(oversampler_mode mode, uint maxblock)
+{
+    using namespace oversampler_detail;
+
+    mode_ = mode;
+    maxblock_ = maxblock;
+    for (uint s = 0; s < maxstages; ++s) {
+        const stage_design &d = (mode == oversampler_linear) ?
+            fir_stages[s] : iir_stages[s];
+        stages_[s] = halfband<R>(mode, d.order, d.transition);
+    }
+    for (jsl::dynarray<R> &buffer : buffer_)
+        buffer.reset(maxblock * Factor);
+}
+
+template <class R, uint Factor>
+void oversampler<R, Factor>::factor(uint factor)
+{
+    Expects(factor > 0 && factor <= Factor && (factor & (factor - 1)) == 0);
+    uint nstages = 0;
+    while ((1u << nstages) < factor)
+        ++nstages;
+    nstages_ = nstages;
+    reset();
+}
+
+template <class R, uint Factor>
+R *oversampler<R, Factor>::up(const R *in, uint n)
+{
+    Expects(n <= maxblock_);
+    const uint nstages = nstages_;
+    R *out = buffer_[0].data();
+    if (nstages == 0) {
+        std::copy_n(in, n, out);
+        return out;
+    }
+    for (uint s = 0; s < nstages; ++s) {
+        out = buffer_[s & 1].data();
+        stages_[s].up(in, out, n << s);
+        in = out;
+    }
+    return out;
+}
+
+template <class R, uint Factor>
+void oversampler<R, Factor>::down(R *out, uint n)
+{
+    Expects(n <= maxblock_);
+    const uint nstages = nstages_;
+    if (nstages == 0) {
+        std::copy_n(buffer_[0].data(), n, out);
+        return;
+    }
+    const R *in = buffer_[(nstages - 1) & 1].data();
+    for (uint s = nstages; s-- > 0;) {
+        R *dst = (s == 0) ? out : buffer_[(s - 1) & 1].data();
+        stages_[s].down(in, dst, n << s);
+        in = dst;
+    }
+}
+
+template <class R, uint Factor>
+void oversampler<R, Factor>::reset()
+{
+    for (halfband<R> &stage : stages_)
+        stage.reset();
+}
+
+template <class R, uint Factor>
+f64 oversampler<R, Factor>::latency() const
+{
+    f64 latency = 0;
+    for (uint s = 0; s < nstages_; ++s)
+        latency += 2 * stages_[s].latency() / (2 << s);
+    return latency;
+}
@@ -0,0 +1,78 @@
+/* Polyphase resampler
+ *
+ * Copyright (C) 2017-2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/dynarray>
+#include <jsl/types>
+
+// parameters of the windowed sinc, which set quality against cost and latency
+struct resampler_preset {
+    uint taps;         // filter length, even
+    uint phases;       // table resolution, a power of two
+    f64 beta;          // Kaiser window parameter
+    f64 passband;      // cutoff relative to the lower Nyquist frequency
+};
+
+enum resampler_quality {
+    resampler_fast,
+    resampler_medium,
+    resampler_best,
+    resampler_quality_count,
+};
+
+const resampler_preset &resampler_get_preset(resampler_quality q);
+
+//------------------------------------------------------------------------------
+// resampler at an arbitrary ratio, using a windowed sinc kernel tabulated at
+// regular phases and interpolated linearly between them
+//
+// the input is written in place by the producer: ask how many samples the
+// next output block requires, write them at `input(c)`, then process.
+template <class R>
+class polyphase_resampler {
+public:
+    polyphase_resampler() noexcept {}
+    polyphase_resampler(
+        f64 inrate, f64 outrate, const resampler_preset &preset,
+        uint channels, uint maxout);
+
+    // number of input samples to provide for the next `nout` outputs
+    uint input_needed(uint nout) const;
+    // location where to write these inputs for channel `c`
+    R *input(uint c)
+        { return &buffer_[c * capacity_ + fill_]; }
+    // produce the outputs after `count` inputs were written
+    void process(uint count, R *const out[], uint nout);
+    // clear the history
+    void reset();
+
+    uint channels() const
+        { return channels_; }
+    uint max_output() const
+        { return maxout_; }
+    // group delay, in input samples
+    uint latency() const
+        { return taps_ / 2; }
+
+private:
+    uint taps_ = 0;
+    uint phases_ = 0;
+    uint phasebits_ = 0;
+    uint channels_ = 0;
+    uint maxout_ = 0;
+    uint capacity_ = 0;
+    // read position, with 32 fractional bits
+    u64 pos_ = 0;
+    u64 step_ = 0;
+    uint fill_ = 0;
+    // rows of values then deltas, one per phase
+    jsl::dynarray<R> table_;
+    // interpolated row, for the current output
+    jsl::dynarray<R> coef_;
+    // inputs, channel-major, each channel of the capacity
+    jsl::dynarray<R> buffer_;
+};
+
+#include "util/dsp/resampler.tcc"
@@ -0,0 +1,164 @@
+#include "util/dsp/resampler.h"
+#include <jsl/math>
+#include <gsl/gsl_assert>
+#include <algorithm>
+#include <cmath>
+
+inline const resampler_preset &resampler_get_preset(resampler_quality q)
+{
+    static const resampler_preset presets[resampler_quality_count] = {
+        {8, 64, 5.0, 0.80},
+        {16, 128, 7.0, 0.88},
+        {32, 256, 9.0, 0.92},
+    };
+    Expects((uint)q < resampler_quality_count);
+    return presets[q];
+}
+
+namespace dsp_detail {
+
+// modified Bessel function of the first kind, order 0
+inline f64 bessel_i0(f64 x)
+{
+    f64 sum = 1, term = 1;
+    const f64 y = 0.25 * x * x;
+    for (uint k = 1; k < 64 && term > 1e-12 * sum; ++k) {
+        term *= y / ((f64)k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+}  // namespace dsp_detail
+
+template <class R>
+polyphase_resampler<R>::polyphase_resampler(
+    f64 inrate, f64 outrate, const resampler_preset &preset,
+    uint channels, uint maxout)
+{
+    const uint taps = preset.taps;
+    const uint phases = preset.phases;
+    Expects(taps >= 2 && taps % 2 == 0);
+    Expects(phases > 0 && (phases & (phases - 1)) == 0);
+    Expects(channels > 0 && maxout > 0);
+
+    const f64 ratio = inrate / outrate;
+    taps_ = taps;
+    phases_ = phases;
+    phasebits_ = 0;
+    while ((1u << phasebits_) < phases)
+        ++phasebits_;
+    channels_ = channels;
+    maxout_ = maxout;
+    step_ = (u64)std::llround(ratio * ((u64)1 << 32));
+    capacity_ = taps + (uint)std::ceil(maxout * ratio) + 2;
+
+    // cutoff in cycles per input sample
+    const f64 fc = 0.5 * preset.passband * std::min<f64>(1, 1 / ratio);
+    const f64 i0beta = dsp_detail::bessel_i0(preset.beta);
+    const f64 halflen = 0.5 * taps;
+
+    jsl::dynarray<f64> h((phases + 1) * taps);
+    for (uint p = 0; p <= phases; ++p) {
+        f64 *row = &h[p * taps];
+        f64 frac = (f64)p / phases;
+        f64 sum = 0;
+        for (uint j = 0; j < taps; ++j) {
+            f64 t = frac + halflen - 1 - j;
+            f64 x = t / halflen;
+            f64 w = (std::fabs(x) < 1) ? dsp_detail::bessel_i0(
+                preset.beta * std::sqrt(1 - x * x)) / i0beta : 0;
+            row[j] = w * jsl::sinc(2 * M_PI * fc * t);
+            sum += row[j];
+        }
+        // unity gain at DC for every phase
+        for (uint j = 0; j < taps; ++j)
+            row[j] /= sum;
+    }
+
+    table_.reset(2 * phases * taps);
+    for (uint p = 0; p < phases; ++p) {
+        R *dst = &table_[2 * p * taps];
+        const f64 *row = &h[p * taps], *next = &h[(p + 1) * taps];
+        for (uint j = 0; j < taps; ++j) {
+            dst[j] = row[j];
+            dst[taps + j] = next[j] - row[j];
+        }
+    }
+
+    coef_.reset(taps);
+    buffer_.reset(channels * capacity_);
+    reset();
+}
+
+template <class R>
+uint polyphase_resampler<R>::input_needed(uint nout) const
+{
+    if (nout == 0)
+        return 0;
+    u64 last = pos_ + (nout - 1) * step_;
+    uint need = (uint)(last >> 32) + taps_;
+    return (need > fill_) ? (need - fill_) : 0;
+}
+
+template <class R>
+void polyphase_resampler<R>::process(uint count, R *const out[], uint nout)
+{
+    const uint taps = taps_;
+    const uint channels = channels_;
+    const uint capacity = capacity_;
+    const uint phaseshift = 32 - phasebits_;
+    const u32 phasemask = ((u64)1 << phaseshift) - 1;
+    const R phasescale = (R)1 / ((u64)1 << phaseshift);
+    const R *table = table_.data();
+    R *buffer = buffer_.data();
+
+    Expects(nout <= maxout_);
+    fill_ += count;
+    Expects(fill_ <= capacity);
+
+    R *coef = coef_.data();
+    u64 pos = pos_;
+    const u64 step = step_;
+
+    for (uint i = 0; i < nout; ++i) {
+        uint index = (uint)(pos >> 32);
+        u32 frac = (u32)pos;
+        const R *row = &table[2 * (frac >> phaseshift) * taps];
+        const R mu = (frac & phasemask) * phasescale;
+
+#pragma omp simd
+        for (uint j = 0; j < taps; ++j)
+            coef[j] = row[j] + mu * row[taps + j];
+
+        for (uint c = 0; c < channels; ++c) {
+            const R *x = &buffer[c * capacity + index];
+            R r = 0;
+#pragma omp simd reduction(+: r)
+            for (uint j = 0; j < taps; ++j)
+                r += x[j] * coef[j];
+            out[c][i] = r;
+        }
+
+        pos += step;
+    }
+
+    // drop the inputs which are no longer needed
+    uint shift = std::min<uint>((uint)(pos >> 32), fill_);
+    for (uint c = 0; c < channels; ++c) {
+        R *x = &buffer[c * capacity];
+        std::copy(&x[shift], &x[fill_], &x[0]);
+    }
+    fill_ -= shift;
+    pos_ = pos - ((u64)shift << 32);
+}
+
+template <class R>
+void polyphase_resampler<R>::reset()
+{
+    buffer_.fill(0);
+    pos_ = 0;
+    // history of zeros, such that the first output is centered on the first
+    // input sample
+    fill_ = taps_ / 2 - 1;
+}
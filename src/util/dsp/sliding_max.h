@@ -0,0 +1,39 @@
+/* Maximum over a sliding window
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/dynarray>
+#include <jsl/types>
+
+// maximum of the last N inputs, in constant time amortized, by a deque of
+// the inputs which can still become the maximum, in decreasing order
+template <class R>
+class sliding_max {
+public:
+    sliding_max() noexcept {}
+    explicit sliding_max(uint capacity);
+
+    // set the length of window, at most the capacity, and clear
+    void length(uint length);
+    uint length() const
+        { return length_; }
+
+    // insert an input, and get the maximum of the window which ends on it
+    R process(R x);
+
+    void reset();
+
+private:
+    uint length_ = 0;
+    // ring of inputs and their times, from front to back
+    jsl::dynarray<R> value_;
+    jsl::dynarray<uint> time_;
+    uint mask_ = 0;
+    uint front_ = 0;
+    uint back_ = 0;
+    uint now_ = 0;
+};
+
+#include "util/dsp/sliding_max.tcc"
@@ -0,0 +1,54 @@
+#include "util/dsp/sliding_max.h"
+#include <gsl/gsl_assert>
+
+template <class R>
+sliding_max<R>::sliding_max(uint capacity)
+{
+    Expects(capacity > 0);
+    uint size = 1;
+    while (size < capacity + 1)
+        size <<= 1;
+    value_.reset(size);
+    time_.reset(size);
+    mask_ = size - 1;
+    length_ = capacity;
+}
+
+template <class R>
+void sliding_max<R>::length(uint length)
+{
+    Expects(length > 0 && length <= mask_);
+    length_ = length;
+    reset();
+}
+
+template <class R>
+R sliding_max<R>::process(R x)
+{
+    const uint mask = mask_;
+    uint front = front_;
+    uint back = back_;
+    uint now = now_;
+
+    // the smaller inputs never will be the maximum, once this one is in
+    while (back != front && value_[(back - 1) & mask] <= x)
+        --back;
+    value_[back & mask] = x;
+    time_[back & mask] = now;
+    ++back;
+
+    // the front leaves when it is out of the window
+    if (now - time_[front & mask] >= length_)
+        ++front;
+
+    front_ = front;
+    back_ = back;
+    now_ = now + 1;
+    return value_[front & mask];
+}
+
+template <class R>
+void sliding_max<R>::reset()
+{
+    front_ = back_ = now_ = 0;
+}
@@ -0,0 +1,71 @@
+/* Short-time Fourier transform, analysis and resynthesis
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include "util/dsp/overlap_add.h"
+#include <jsl/dynarray>
+#include <jsl/types>
+
+// frames of the input windowed and transformed, the spectrum passed to a
+// function which modifies it in place, and the output resynthesized by
+// overlap-add with the same window. the output of a frame begins one step
+// after it. the size of window is any power of two in a range, and the step
+// may change on each frame; all the memory and plans are obtained at
+// creation. `Api` is the precision of FFTW, as defined in fftw++.h.
+template <class Api>
+class stft {
+public:
+    typedef typename Api::real real;
+    typedef typename Api::complex complex;
+
+    stft() noexcept {}
+    // `window(real *w, size_t size)` computes the window of each size
+    template <class W> stft(size_t minsize, size_t maxsize, W &&window);
+
+    // process any number of samples, calling `fn(complex *, size_t bins)`
+    // for each frame. the variant with `hop(size_t offset)` asks for the
+    // step before the frame at this offset of the input.
+    template <class F> void process(const real *in, real *out, size_t n, F &&fn);
+    template <class F, class H> void process(const real *in, real *out, size_t n, F &&fn, H &&hop);
+
+    // set the size of window from the next frame, false if not a power of
+    // two in the range
+    bool winsize(size_t size);
+    // set the step from the next frame, between 1 and the size of window
+    void step(size_t step);
+
+    size_t winsize() const
+        { return nextwinsize_; }
+    size_t step() const
+        { return step_; }
+    size_t minsize() const
+        { return minsize_; }
+    size_t maxsize() const
+        { return maxsize_; }
+
+private:
+    template <class F> void frame(F &&fn, size_t step);
+
+    size_t minsize_ = 0;
+    size_t maxsize_ = 0;
+    size_t nextwinsize_ = 0;
+    size_t step_ = 0;
+    // the windows of all sizes, each at offset `size - minsize`
+    jsl::dynarray<real> windows_;
+    // input history, stored twice so the last frame is always contiguous
+    jsl::dynarray<real> hist_;
+    size_t histidx_ = 0;
+    // sum of the frames, each added after the output of its step
+    overlap_add<real> ola_;
+    // samples until the next frame
+    size_t remain_ = 0;
+    typename Api::template dynarray<real> real_;
+    typename Api::template dynarray<complex> cplx_;
+    // plans of all sizes, from the smallest
+    jsl::dynarray<typename Api::plan> fwd_;
+    jsl::dynarray<typename Api::plan> bwd_;
+};
+
+#include "util/dsp/stft.tcc"
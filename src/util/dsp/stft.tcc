@@ -0,0 +1,121 @@
+#include "util/dsp/stft.h"
+#include "util/fftw++.h"
+#include <gsl/gsl_assert>
+#include <algorithm>
+
+template <class Api>
+template <class W>
+stft<Api>::stft(size_t minsize, size_t maxsize, W &&window)
+{
+    Expects(minsize > 0 && (minsize & (minsize - 1)) == 0);
+    Expects(maxsize >= minsize && (maxsize & (maxsize - 1)) == 0);
+
+    minsize_ = minsize;
+    maxsize_ = maxsize;
+    nextwinsize_ = maxsize;
+    step_ = maxsize / 2;
+
+    // the sizes before one sum to `size - minsize`
+    windows_.reset(2 * maxsize - minsize);
+    for (size_t size = minsize; size <= maxsize; size *= 2)
+        window(&windows_[size - minsize], size);
+
+    hist_.reset(2 * maxsize);
+    ola_ = overlap_add<real>(maxsize);
+
+    real_.reset(maxsize);
+    cplx_.reset(maxsize / 2 + 1);
+    size_t nplans = 0;
+    for (size_t size = minsize; size <= maxsize; size *= 2)
+        ++nplans;
+    fwd_.reset(nplans);
+    bwd_.reset(nplans);
+    for (size_t i = 0; i < nplans; ++i) {
+        int size = minsize << i;
+        fwd_[i] = fftw_pp::plan_cache<Api>::r2c_1d(size, real_.data(), cplx_.data());
+        bwd_[i] = fftw_pp::plan_cache<Api>::c2r_1d(size, cplx_.data(), real_.data());
+    }
+}
+
+template <class Api>
+bool stft<Api>::winsize(size_t size)
+{
+    if (size < minsize_ || size > maxsize_ || (size & (size - 1)) != 0)
+        return false;
+    nextwinsize_ = size;
+    return true;
+}
+
+template <class Api>
+void stft<Api>::step(size_t step)
+{
+    step_ = step;
+}
+
+template <class Api>
+template <class F>
+void stft<Api>::process(const real *in, real *out, size_t n, F &&fn)
+{
+    process(in, out, n, fn, [this](size_t) -> size_t { return step_; });
+}
+
+template <class Api>
+template <class F, class H>
+void stft<Api>::process(const real *in, real *out, size_t n, F &&fn, H &&hop)
+{
+    const size_t maxsize = maxsize_;
+    real *hist = hist_.data();
+
+    for (size_t offset = 0; offset < n;) {
+        if (remain_ == 0) {
+            size_t step = std::min<size_t>(std::max<size_t>(hop(offset), 1), maxsize);
+            frame(fn, step);
+            remain_ = step;
+        }
+
+        size_t count = std::min(n - offset, remain_);
+        const real *src = in + offset;
+        real *dst = out + offset;
+
+        // the parts before the history wraps around, and after
+        size_t histidx = histidx_;
+        size_t n1 = std::min(count, maxsize - histidx);
+        std::copy(src, src + n1, &hist[histidx]);
+        std::copy(src, src + n1, &hist[histidx + maxsize]);
+        std::copy(src + n1, src + count, &hist[0]);
+        std::copy(src + n1, src + count, &hist[maxsize]);
+        histidx_ = (histidx + count) & (maxsize - 1);
+
+        ola_.read(dst, count);
+
+        offset += count;
+        remain_ -= count;
+    }
+}
+
+template <class Api>
+template <class F>
+void stft<Api>::frame(F &&fn, size_t step)
+{
+    const size_t winsize = nextwinsize_;
+    const size_t maxsize = maxsize_;
+    const real *window = &windows_[winsize - minsize_];
+    const real *hist = &hist_[histidx_ + maxsize - winsize];
+    real *re = real_.data();
+    complex *cp = cplx_.data();
+
+    size_t plan = 0;
+    while ((minsize_ << plan) < winsize)
+        ++plan;
+
+#pragma omp simd
+    for (size_t i = 0; i < winsize; ++i)
+        re[i] = window[i] * hist[i];
+
+    Api::execute_r2c(fwd_[plan], re, cp);
+    fn(cp, winsize / 2 + 1);
+    Api::execute_c2r(bwd_[plan], cp, re);
+
+    // add after the output of the coming step, normalizing the transform
+    ola_.add(re, window, winsize, step, (real)1 / winsize);
+}
@@ -0,0 +1,35 @@
+/* Detection of true peaks, by oversampling
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/types>
+
+// absolute peak of a signal and of the points interpolated between its
+// samples at 4 times the rate, by a polyphase windowed-sinc FIR. the peak
+// given is the one of the input `latency` samples ago, with or without the
+// interpolation, so that it may be switched without changing the delay.
+template <class R>
+class true_peak {
+public:
+    enum {
+        factor = 4,
+        taps = 12,           // per phase
+        latency = taps / 2,
+    };
+
+    true_peak() noexcept;
+
+    R process(R x, bool oversample);
+    void reset();
+
+private:
+    // history stored twice, contiguous from any position
+    R hist_[2 * taps] = {};
+    uint histidx_ = 0;
+    // coefficients of the phases between the samples, the taps reversed
+    R coef_[factor - 1][taps];
+};
+
+#include "util/dsp/true_peak.tcc"
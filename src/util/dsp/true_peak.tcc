@@ -0,0 +1,55 @@
+#include "util/dsp/true_peak.h"
+#include <algorithm>
+#include <cmath>
+
+template <class R>
+true_peak<R>::true_peak() noexcept
+{
+    for (uint k = 1; k < factor; ++k) {
+        R *coef = coef_[k - 1];
+        double sum = 0;
+        // the point at `latency - 1 + k/factor` samples ago
+        for (uint j = 0; j < taps; ++j) {
+            double t = (double)j - (latency - 1) - (double)k / factor;
+            double s = (t == 0) ? 1 : (std::sin(M_PI * t) / (M_PI * t));
+            double u = (t + taps / 2.0) / taps;
+            double w = 0.42 - 0.5 * std::cos(2 * M_PI * u) + 0.08 * std::cos(4 * M_PI * u);
+            coef[j] = s * w;
+            sum += coef[j];
+        }
+        for (uint j = 0; j < taps; ++j)
+            coef[j] /= sum;
+    }
+}
+
+template <class R>
+R true_peak<R>::process(R x, bool oversample)
+{
+    uint histidx = histidx_;
+    hist_[histidx] = hist_[histidx + taps] = x;
+    histidx = (histidx + 1 == taps) ? 0 : (histidx + 1);
+    histidx_ = histidx;
+
+    // from the newest to the oldest
+    const R *hist = &hist_[histidx];
+    R peak = std::fabs(hist[taps - 1 - latency]);
+    if (!oversample)
+        return peak;
+
+    for (uint k = 0; k < factor - 1; ++k) {
+        const R *coef = coef_[k];
+        R y = 0;
+#pragma omp simd reduction(+: y)
+        for (uint j = 0; j < taps; ++j)
+            y += coef[j] * hist[taps - 1 - j];
+        peak = std::max(peak, std::fabs(y));
+    }
+    return peak;
+}
+
+template <class R>
+void true_peak<R>::reset()
+{
+    std::fill(hist_, hist_ + 2 * taps, 0);
+    histidx_ = 0;
+}
@@ -3,11 +3,58 @@
 #include <jsl/dynarray>
 #include <complex>
 #include <memory>
+#include <map>
+#include <mutex>
+#include <string>
 
 #define FFTW_DEFINE_COMPLEX(R, C) typedef std::complex<R> C
 #include "util/api/fftw3mod.h"
 
-#define FFTW_PP_DEFINE_API(X, R, C)                                     \
+namespace fftw_pp {
+
+enum plan_direction { plan_r2c, plan_c2r };
+
+// plans shared between all the users in the module, and the wisdom of the
+// planner kept in a file across runs. a plan is valid for any arrays which
+// have the same alignments as the arrays passed at creation, and it remains
+// owned by the cache.
+template <class Api>
+class plan_cache {
+public:
+    typedef typename Api::real real;
+    typedef typename Api::complex complex;
+    typedef typename Api::plan plan;
+
+    static plan r2c_1d(int n, const real *in, const complex *out);
+    static plan c2r_1d(int n, const complex *in, const real *out);
+
+private:
+    struct key {
+        plan_direction direction;
+        int size;
+        int inalign;
+        int outalign;
+        bool operator<(const key &o) const;
+    };
+
+    plan_cache() {}
+    static plan_cache &instance();
+    plan get(const key &k);
+    plan create(const key &k);
+
+    std::mutex mutex_;
+    std::map<key, typename Api::plan_u> plans_;
+    std::string wisdomfile_;
+    bool wisdomloaded_ = false;
+};
+
+// location of the wisdom file, by variable PDEX_FFTW_WISDOM or else in the
+// cache directory of the user, empty if unknown
+inline std::string wisdom_file(const char *name);
+
+}  // namespace fftw_pp
+
+#define FFTW_PP_DEFINE_API(X, R, C, NAME)                               \
     struct X(allocator_traits) {                                        \
         static void *allocate(std::size_t n)                            \
             /**/{ return ::X(malloc)(n); }                              \
@@ -27,10 +74,42 @@
     };                                                                  \
                                                                         \
     typedef std::unique_ptr<X(plan_s), X(plan_deleter)> X(plan_u);      \
+                                                                        \
+    struct X(api) {                                                     \
+        typedef R real;                                                 \
+        typedef C complex;                                              \
+        typedef X(plan) plan;                                           \
+        typedef X(plan_u) plan_u;                                       \
+        template <class T> using dynarray = X(dynarray)<T>;             \
+        static const char *name()                                       \
+            /**/{ return NAME; }                                        \
+        static void *malloc(std::size_t n)                              \
+            /**/{ return ::X(malloc)(n); }                              \
+        static void free(void *p)                                       \
+            /**/{ ::X(free)(p); }                                       \
+        static int alignment_of(const void *p)                          \
+            /**/{ return ::X(alignment_of)((R *)p); }                   \
+        static plan plan_r2c_1d(int n, R *in, C *out, unsigned flags)   \
+            /**/{ return ::X(plan_dft_r2c_1d)(n, in, out, flags); }     \
+        static plan plan_c2r_1d(int n, C *in, R *out, unsigned flags)   \
+            /**/{ return ::X(plan_dft_c2r_1d)(n, in, out, flags); }     \
+        static void execute_r2c(plan p, R *in, C *out)                  \
+            /**/{ ::X(execute_dft_r2c)(p, in, out); }                   \
+        static void execute_c2r(plan p, C *in, R *out)                  \
+            /**/{ ::X(execute_dft_c2r)(p, in, out); }                   \
+        static bool import_wisdom(const char *path)                     \
+            /**/{ return ::X(import_wisdom_from_filename)(path); }      \
+        static bool export_wisdom(const char *path)                     \
+            /**/{ return ::X(export_wisdom_to_filename)(path); }        \
+    };                                                                  \
+                                                                        \
+    typedef fftw_pp::plan_cache<X(api)> X(plan_cache);                  \
 
 //------------------------------------------------------------------------------
-FFTW_PP_DEFINE_API(FFTW_MANGLE_DOUBLE, double, fftw_complex);
-FFTW_PP_DEFINE_API(FFTW_MANGLE_FLOAT, float, fftwf_complex);
-FFTW_PP_DEFINE_API(FFTW_MANGLE_LONG_DOUBLE, long double, fftwl_complex);
+FFTW_PP_DEFINE_API(FFTW_MANGLE_DOUBLE, double, fftw_complex, "fftw");
+FFTW_PP_DEFINE_API(FFTW_MANGLE_FLOAT, float, fftwf_complex, "fftwf");
+FFTW_PP_DEFINE_API(FFTW_MANGLE_LONG_DOUBLE, long double, fftwl_complex, "fftwl");
 
 #undef FFTW_PP_DEFINE_API
+
+#include "util/fftw++.tcc"
@@ -0,0 +1,133 @@
+#include "util/fftw++.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace fftw_pp {
+
+template <class Api>
+auto plan_cache<Api>::r2c_1d(int n, const real *in, const complex *out) -> plan
+{
+    key k;
+    k.direction = plan_r2c;
+    k.size = n;
+    k.inalign = Api::alignment_of(in);
+    k.outalign = Api::alignment_of(out);
+    return instance().get(k);
+}
+
+template <class Api>
+auto plan_cache<Api>::c2r_1d(int n, const complex *in, const real *out) -> plan
+{
+    key k;
+    k.direction = plan_c2r;
+    k.size = n;
+    k.inalign = Api::alignment_of(in);
+    k.outalign = Api::alignment_of(out);
+    return instance().get(k);
+}
+
+template <class Api>
+bool plan_cache<Api>::key::operator<(const key &o) const
+{
+    if (direction != o.direction)
+        return direction < o.direction;
+    if (size != o.size)
+        return size < o.size;
+    if (inalign != o.inalign)
+        return inalign < o.inalign;
+    return outalign < o.outalign;
+}
+
+template <class Api>
+auto plan_cache<Api>::instance() -> plan_cache &
+{
+    static plan_cache cache;
+    return cache;
+}
+
+template <class Api>
+auto plan_cache<Api>::get(const key &k) -> plan
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = plans_.find(k);
+    if (it != plans_.end())
+        return it->second.get();
+
+    if (!wisdomloaded_) {
+        wisdomfile_ = wisdom_file(Api::name());
+        if (!wisdomfile_.empty())
+            Api::import_wisdom(wisdomfile_.c_str());
+        wisdomloaded_ = true;
+    }
+
+    typename Api::plan_u u(create(k));
+    plan p = u.get();
+    plans_[k] = std::move(u);
+
+    // replace the file at once, in case another module writes it too
+    if (!wisdomfile_.empty()) {
+        std::string tmpfile = wisdomfile_ + ".tmp";
+        if (Api::export_wisdom(tmpfile.c_str()))
+            std::rename(tmpfile.c_str(), wisdomfile_.c_str());
+    }
+
+    return p;
+}
+
+template <class Api>
+auto plan_cache<Api>::create(const key &k) -> plan
+{
+    // measure on scratch arrays, misaligned like the arrays of the user
+    const int n = k.size;
+    const size_t nreal = n * sizeof(real) + k.inalign + k.outalign;
+    const size_t ncplx = (n / 2 + 1) * sizeof(complex) + k.inalign + k.outalign;
+
+    std::unique_ptr<void, void (*)(void *)> inmem(
+        Api::malloc(std::max(nreal, ncplx)), &Api::free);
+    std::unique_ptr<void, void (*)(void *)> outmem(
+        Api::malloc(std::max(nreal, ncplx)), &Api::free);
+    if (!inmem || !outmem)
+        throw std::bad_alloc();
+
+    char *in = (char *)inmem.get() + k.inalign;
+    char *out = (char *)outmem.get() + k.outalign;
+
+    plan p = nullptr;
+    switch (k.direction) {
+    case plan_r2c:
+        p = Api::plan_r2c_1d(n, (real *)in, (complex *)out, 0);
+        break;
+    case plan_c2r:
+        p = Api::plan_c2r_1d(n, (complex *)in, (real *)out, 0);
+        break;
+    }
+
+    if (!p)
+        throw std::runtime_error("error planning FFT");
+    return p;
+}
+
+inline std::string wisdom_file(const char *name)
+{
+    if (const char *path = std::getenv("PDEX_FFTW_WISDOM"))
+        return std::string(path) + '.' + name;
+
+    std::string dir;
+#if defined(_WIN32)
+    if (const char *local = std::getenv("LOCALAPPDATA"))
+        dir = local;
+#else
+    if (const char *cache = std::getenv("XDG_CACHE_HOME"))
+        dir = cache;
+    else if (const char *home = std::getenv("HOME"))
+        dir = std::string(home) + "/.cache";
+#endif
+    if (dir.empty())
+        return std::string();
+    return dir + "/jpcex-" + name + ".wisdom";
+}
+
+}  // namespace fftw_pp
@@ -21,6 +21,10 @@ pzk_t<R> iir_lowpass(const pzk_t<R> &pzk, R f);
 template <class R>
 coef_t<R> bilinear(const coef_t<R> &in, R fs);
 
+// discretize analog filter in pole zero form with bilinear method
+template <class R>
+pzk_t<R> iir_pzk_bilinear(const pzk_t<R> &pzk, R fs);
+
 // design a filter using the windowed sync method
 template <class R>
 jsl::dynarray<R> fir1(R fc, const jsl::dynarray<R> &win);
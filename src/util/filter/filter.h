@@ -7,6 +7,8 @@
 #include <jsl/dynarray>
 #include <jsl/types>
 
+template <class R> struct pzk_t;
+
 // coefs H=[B,A]
 template <class R>
 struct coef_t {
@@ -17,6 +19,8 @@ struct coef_t {
     void normalize();
     // convert to other real type
     template <class T> coef_t<T> to() const;
+    // convert to pole zero, by finding polynomial roots
+    pzk_t<R> pzk() const;
 };
 
 // pole zero with gain
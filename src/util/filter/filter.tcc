@@ -7,6 +7,46 @@
 #include <jsl/math>
 #include <gsl/gsl_assert>
 #include <algorithm>
+#include <limits>
+
+namespace filter_detail {
+
+// roots of polynomial in descending powers, p[0] != 0 (Durand-Kerner)
+template <class R>
+void roots(const R *p, uint n, std::complex<R> *z)
+{
+    typedef std::complex<R> C;
+
+    R bound = 0;
+    for (uint i = 1; i <= n; ++i)
+        bound = std::max(bound, std::abs(p[i] / p[0]));
+    bound += 1;
+
+    C w = 1;
+    for (uint i = 0; i < n; ++i) {
+        z[i] = bound * w;
+        w *= C(0.4, 0.9);
+    }
+
+    const R eps = 4 * std::numeric_limits<R>::epsilon();
+    for (uint iter = 0; iter < 1000; ++iter) {
+        R maxdelta = 0;
+        for (uint i = 0; i < n; ++i) {
+            C num = 1, den = 1;
+            for (uint j = 1; j <= n; ++j)
+                num = num * z[i] + p[j] / p[0];
+            for (uint j = 0; j < n; ++j)
+                den *= (j == i) ? C(1) : (z[i] - z[j]);
+            C delta = num / den;
+            z[i] -= delta;
+            maxdelta = std::max(maxdelta, std::abs(delta) / std::max<R>(1, std::abs(z[i])));
+        }
+        if (maxdelta < eps)
+            break;
+    }
+}
+
+}  // namespace filter_detail
 
 template <class R>
 auto coef_t<R>::padded(uint minsize, uint multiple) const -> coef_t
@@ -63,6 +103,26 @@ coef_t<T> coef_t<R>::to() const
     return c;
 }
 
+template <class R>
+pzk_t<R> coef_t<R>::pzk() const
+{
+    typedef std::complex<R> C;
+
+    const jsl::dynarray<R> &b = this->b, &a = this->a;
+    uint nb = b.size(), na = a.size();
+    // Trim leading zeros, leave at least one.
+    uint ib = 0, ia = 0;
+    while (ib + 1 < nb && b[ib] == 0) ++ib;
+    while (ia + 1 < na && a[ia] == 0) ++ia;
+    Expects(ib < nb && ia < na && a[ia] != 0);
+
+    jsl::dynarray<C> z(nb - ib - 1), p(na - ia - 1);
+    filter_detail::roots(&b[ib], z.size(), z.data());
+    filter_detail::roots(&a[ia], p.size(), p.data());
+
+    return pzk_t<R>{std::move(p), std::move(z), b[ib] / a[ia]};
+}
+
 template <class R>
 coef_t<R> pzk_t<R>::coefs() const
 {
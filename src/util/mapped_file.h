@@ -0,0 +1,36 @@
+/* Read-only mapping of files in memory
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/types>
+#include <cstddef>
+
+// the contents of a file, paged in on demand by the system
+class mapped_file {
+public:
+    mapped_file() {}
+    ~mapped_file() { close(); }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    // throw std::runtime_error in case of failure
+    template <class = void> void open(const char *path);
+    template <class = void> void close();
+
+    const u8 *data() const
+        { return data_; }
+    size_t size() const
+        { return size_; }
+
+private:
+    const u8 *data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    void *mapping_ = nullptr;
+#endif
+};
+
+#include "mapped_file.tcc"
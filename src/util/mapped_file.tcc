@@ -0,0 +1,87 @@
+/* Read-only mapping of files in memory
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#include "mapped_file.h"
+#include <stdexcept>
+#if defined(_WIN32)
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+template <class> void mapped_file::open(const char *path)
+{
+    close();
+
+    HANDLE fh = CreateFileA(
+        path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fh == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("cannot open file");
+
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    const void *data = nullptr;
+    if (GetFileSizeEx(fh, &size) && size.QuadPart > 0)
+        mapping = CreateFileMappingA(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping)
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(fh);
+
+    if (!data) {
+        if (mapping)
+            CloseHandle(mapping);
+        throw std::runtime_error("cannot map file");
+    }
+
+    data_ = (const u8 *)data;
+    size_ = size.QuadPart;
+    mapping_ = mapping;
+}
+
+template <class> void mapped_file::close()
+{
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mapping_)
+        CloseHandle((HANDLE)mapping_);
+    data_ = nullptr;
+    size_ = 0;
+    mapping_ = nullptr;
+}
+#else
+template <class> void mapped_file::open(const char *path)
+{
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd == -1)
+        throw std::runtime_error("cannot open file");
+
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+        throw std::runtime_error("cannot map file");
+
+    data_ = (const u8 *)data;
+    size_ = st.st_size;
+}
+
+template <class> void mapped_file::close()
+{
+    if (data_)
+        munmap((void *)data_, size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+#endif
@@ -43,8 +43,13 @@ struct pd_outlet_deleter {
     void operator()(t_outlet *x) { outlet_free(x); }
 };
 
+struct pd_clock_deleter {
+    void operator()(t_clock *x) { clock_free(x); }
+};
+
 typedef std::unique_ptr<t_inlet, pd_inlet_deleter> u_inlet;
 typedef std::unique_ptr<t_outlet, pd_outlet_deleter> u_outlet;
+typedef std::unique_ptr<t_clock, pd_clock_deleter> u_clock;
 
 //------------------------------------------------------------------------------
 struct pd_object_deleter {
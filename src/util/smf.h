@@ -0,0 +1,39 @@
+/* Reader of standard MIDI files
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/types>
+#include <vector>
+#include <cstddef>
+
+// event of a file, with the time converted by the tempo map
+struct SMF_Event {
+    double time = 0;      // in seconds
+    uint offset = 0;      // location in the data
+    uint length = 0;      // size of message, sysex included entire
+};
+
+// the tracks of a file merged in a single sequence of timed messages,
+// keeping only channel messages and sysex
+class SMF_File {
+public:
+    // throw std::runtime_error in case of failure
+    template <class = void> void load(const char *path);
+    template <class = void> void parse(const u8 *data, size_t size);
+
+    const std::vector<SMF_Event> &events() const
+        { return events_; }
+    const u8 *data(const SMF_Event &ev) const
+        { return &data_[ev.offset]; }
+    // time of the last event, in seconds
+    double duration() const
+        { return events_.empty() ? 0 : events_.back().time; }
+
+private:
+    std::vector<SMF_Event> events_;
+    std::vector<u8> data_;
+};
+
+#include "smf.tcc"
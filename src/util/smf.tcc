@@ -0,0 +1,204 @@
+/* Reader of standard MIDI files
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#include "smf.h"
+#include "midi.h"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <cstdio>
+
+namespace smf_detail {
+
+struct track_event {
+    u64 tick;
+    uint offset;
+    uint length;
+    u32 tempo;            // nonzero for a change of tempo
+};
+
+struct reader {
+    const u8 *pos;
+    const u8 *end;
+
+    void need(size_t n)
+    {
+        if ((size_t)(end - pos) < n)
+            throw std::runtime_error("truncated MIDI file");
+    }
+    uint byte()
+        { need(1); return *pos++; }
+    u32 be(uint n)
+    {
+        need(n);
+        u32 v = 0;
+        for (uint i = 0; i < n; ++i)
+            v = (v << 8) | *pos++;
+        return v;
+    }
+    u32 vlq()
+    {
+        u32 v = 0;
+        for (uint i = 0; i < 4; ++i) {
+            uint b = byte();
+            v = (v << 7) | (b & 0x7f);
+            if (!(b & 0x80))
+                return v;
+        }
+        throw std::runtime_error("invalid MIDI file");
+    }
+};
+
+}  // namespace smf_detail
+
+template <class> void SMF_File::load(const char *path)
+{
+    std::unique_ptr<FILE, int (*)(FILE *)> fh(fopen(path, "rb"), &fclose);
+    if (!fh)
+        throw std::runtime_error("cannot open MIDI file");
+
+    std::vector<u8> content;
+    u8 buf[8192];
+    size_t count;
+    while ((count = fread(buf, 1, sizeof(buf), fh.get())) > 0)
+        content.insert(content.end(), buf, buf + count);
+    if (ferror(fh.get()))
+        throw std::runtime_error("cannot read MIDI file");
+
+    parse(content.data(), content.size());
+}
+
+template <class> void SMF_File::parse(const u8 *data, size_t size)
+{
+    using smf_detail::track_event;
+    smf_detail::reader rd{data, data + size};
+
+    events_.clear();
+    data_.clear();
+
+    rd.need(8);
+    if (std::string((const char *)rd.pos, 4) != "MThd")
+        throw std::runtime_error("not a MIDI file");
+    rd.pos += 4;
+    u32 hdrlen = rd.be(4);
+    rd.need(hdrlen);
+    if (hdrlen < 6)
+        throw std::runtime_error("invalid MIDI file");
+    smf_detail::reader hdr{rd.pos, rd.pos + hdrlen};
+    rd.pos += hdrlen;
+    /*format*/ hdr.be(2);
+    uint ntracks = hdr.be(2);
+    uint division = hdr.be(2);
+    if (division == 0)
+        throw std::runtime_error("invalid MIDI file");
+
+    std::vector<track_event> trackevs;
+
+    for (uint track = 0; track < ntracks && rd.pos != rd.end;) {
+        rd.need(8);
+        bool istrack = std::string((const char *)rd.pos, 4) == "MTrk";
+        rd.pos += 4;
+        u32 chunklen = rd.be(4);
+        rd.need(chunklen);
+        smf_detail::reader trk{rd.pos, rd.pos + chunklen};
+        rd.pos += chunklen;
+        if (!istrack)
+            continue;  // unknown chunk, skip
+        ++track;
+
+        u64 tick = 0;
+        uint status = 0;
+        while (trk.pos != trk.end) {
+            tick += trk.vlq();
+            uint id = trk.byte();
+
+            track_event ev{tick, (uint)data_.size(), 0, 0};
+
+            if (id == 0xff) {
+                uint type = trk.byte();
+                u32 len = trk.vlq();
+                trk.need(len);
+                if (type == 0x51 && len == 3) {
+                    ev.tempo = (trk.pos[0] << 16) | (trk.pos[1] << 8) | trk.pos[2];
+                    if (ev.tempo > 0)
+                        trackevs.push_back(ev);
+                }
+                trk.pos += len;
+                if (type == 0x2f)
+                    break;
+            }
+            else if (id == 0xf0 || id == 0xf7) {
+                u32 len = trk.vlq();
+                trk.need(len);
+                // keep the complete sysex, ignore the escapes
+                if (id == 0xf0) {
+                    data_.push_back(0xf0);
+                    data_.insert(data_.end(), trk.pos, trk.pos + len);
+                    if (data_.back() != 0xf7)
+                        data_.push_back(0xf7);
+                    ev.length = data_.size() - ev.offset;
+                    trackevs.push_back(ev);
+                }
+                trk.pos += len;
+                status = 0;
+            }
+            else {
+                // channel message, possibly with running status
+                if (id & 0x80)
+                    status = id;
+                else {
+                    if (!status)
+                        throw std::runtime_error("invalid MIDI file");
+                    --trk.pos;
+                }
+                uint len = midi_message_sizeof(status);
+                if (len == 0)
+                    throw std::runtime_error("invalid MIDI file");
+                data_.push_back(status);
+                for (uint i = 1; i < len; ++i)
+                    data_.push_back(trk.byte() & 0x7f);
+                ev.length = len;
+                trackevs.push_back(ev);
+            }
+        }
+    }
+
+    // merge the tracks, the first ones first when simultaneous
+    std::stable_sort(
+        trackevs.begin(), trackevs.end(),
+        [](const track_event &a, const track_event &b) { return a.tick < b.tick; });
+
+    // ticks are fractions of a quarter note, or of a SMPTE frame
+    double tickduration;
+    bool smpte = (division & 0x8000) != 0;
+    if (smpte) {
+        uint fps = 256 - (division >> 8);
+        uint subframes = division & 0xff;
+        if (subframes == 0)
+            throw std::runtime_error("invalid MIDI file");
+        tickduration = 1.0 / ((fps == 29 ? 29.97 : fps) * subframes);
+    }
+    else
+        tickduration = 500000e-6 / division;
+
+    events_.reserve(trackevs.size());
+    double time = 0;
+    u64 lasttick = 0;
+    for (const track_event &tev : trackevs) {
+        time += (tev.tick - lasttick) * tickduration;
+        lasttick = tev.tick;
+        if (tev.tempo) {
+            if (!smpte)
+                tickduration = tev.tempo * 1e-6 / division;
+            continue;
+        }
+        SMF_Event ev;
+        ev.time = time;
+        ev.offset = tev.offset;
+        ev.length = tev.length;
+        events_.push_back(ev);
+    }
+}
@@ -0,0 +1,43 @@
+/* Lock-free queue for a single producer and a single consumer
+ *
+ * Copyright (C) 2017-2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/dynarray>
+#include <jsl/types>
+#include <atomic>
+
+template <class T>
+class spsc_queue {
+public:
+    spsc_queue() noexcept {}
+    explicit spsc_queue(uint capacity)
+        { reset(capacity); }
+
+    // allocate for at least `capacity` elements, and clear (not concurrent)
+    void reset(uint capacity);
+
+    // producer: insert at the back, false if the queue is full
+    bool push(const T &x);
+    // producer: whether the next insertion would fail
+    bool full() const;
+
+    // consumer: access the front, null if the queue is empty
+    const T *front() const;
+    // consumer: remove the front, which must exist
+    void pop();
+
+    bool empty() const
+        { return front() == nullptr; }
+    uint capacity() const
+        { return buffer_.size(); }
+
+private:
+    jsl::dynarray<T> buffer_;
+    uint mask_ = 0;
+    std::atomic<uint> rd_{0};
+    std::atomic<uint> wr_{0};
+};
+
+#include "util/spsc_queue.tcc"
@@ -0,0 +1,50 @@
+#include "util/spsc_queue.h"
+
+template <class T>
+void spsc_queue<T>::reset(uint capacity)
+{
+    uint size = 1;
+    while (size < capacity)
+        size <<= 1;
+    buffer_.reset(size);
+    mask_ = size - 1;
+    rd_.store(0, std::memory_order_relaxed);
+    wr_.store(0, std::memory_order_relaxed);
+}
+
+template <class T>
+bool spsc_queue<T>::push(const T &x)
+{
+    uint wr = wr_.load(std::memory_order_relaxed);
+    uint rd = rd_.load(std::memory_order_acquire);
+    if (wr - rd > mask_)
+        return false;
+    buffer_[wr & mask_] = x;
+    wr_.store(wr + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool spsc_queue<T>::full() const
+{
+    uint wr = wr_.load(std::memory_order_relaxed);
+    uint rd = rd_.load(std::memory_order_acquire);
+    return wr - rd > mask_;
+}
+
+template <class T>
+const T *spsc_queue<T>::front() const
+{
+    uint rd = rd_.load(std::memory_order_relaxed);
+    uint wr = wr_.load(std::memory_order_acquire);
+    if (rd == wr)
+        return nullptr;
+    return &buffer_[rd & mask_];
+}
+
+template <class T>
+void spsc_queue<T>::pop()
+{
+    uint rd = rd_.load(std::memory_order_relaxed);
+    rd_.store(rd + 1, std::memory_order_release);
+}
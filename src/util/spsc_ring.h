@@ -0,0 +1,42 @@
+/* Lock-free ring buffer for a single producer and a single consumer
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/dynarray>
+#include <jsl/types>
+#include <atomic>
+
+// a queue like spsc_queue, which transfers elements in bulk
+template <class T>
+class spsc_ring {
+public:
+    spsc_ring() noexcept {}
+    explicit spsc_ring(uint capacity)
+        { reset(capacity); }
+
+    // allocate for at least `capacity` elements, and clear (not concurrent)
+    void reset(uint capacity);
+
+    // producer: insert `n` elements, false if there is not enough space
+    bool write(const T *src, uint n);
+    // producer: number of elements which can be written
+    uint write_space() const;
+
+    // consumer: remove `n` elements, false if there are not as many
+    bool read(T *dst, uint n);
+    // consumer: number of elements which can be read
+    uint read_space() const;
+
+    uint capacity() const
+        { return buffer_.size(); }
+
+private:
+    jsl::dynarray<T> buffer_;
+    uint mask_ = 0;
+    std::atomic<uint> rd_{0};
+    std::atomic<uint> wr_{0};
+};
+
+#include "util/spsc_ring.tcc"
@@ -0,0 +1,63 @@
+#include "util/spsc_ring.h"
+#include <algorithm>
+
+template <class T>
+void spsc_ring<T>::reset(uint capacity)
+{
+    uint size = 1;
+    while (size < capacity)
+        size <<= 1;
+    buffer_.reset(size);
+    mask_ = size - 1;
+    rd_.store(0, std::memory_order_relaxed);
+    wr_.store(0, std::memory_order_relaxed);
+}
+
+template <class T>
+bool spsc_ring<T>::write(const T *src, uint n)
+{
+    uint wr = wr_.load(std::memory_order_relaxed);
+    uint rd = rd_.load(std::memory_order_acquire);
+    const uint size = mask_ + 1;
+    if (size - (wr - rd) < n)
+        return false;
+    // in two parts, at the end and at the start
+    uint pos = wr & mask_;
+    uint n1 = std::min(n, size - pos);
+    std::copy(src, src + n1, &buffer_[pos]);
+    std::copy(src + n1, src + n, &buffer_[0]);
+    wr_.store(wr + n, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+uint spsc_ring<T>::write_space() const
+{
+    uint wr = wr_.load(std::memory_order_relaxed);
+    uint rd = rd_.load(std::memory_order_acquire);
+    return (mask_ + 1) - (wr - rd);
+}
+
+template <class T>
+bool spsc_ring<T>::read(T *dst, uint n)
+{
+    uint rd = rd_.load(std::memory_order_relaxed);
+    uint wr = wr_.load(std::memory_order_acquire);
+    const uint size = mask_ + 1;
+    if (wr - rd < n)
+        return false;
+    uint pos = rd & mask_;
+    uint n1 = std::min(n, size - pos);
+    std::copy(&buffer_[pos], &buffer_[pos] + n1, dst);
+    std::copy(&buffer_[0], &buffer_[0] + (n - n1), dst + n1);
+    rd_.store(rd + n, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+uint spsc_ring<T>::read_space() const
+{
+    uint rd = rd_.load(std::memory_order_relaxed);
+    uint wr = wr_.load(std::memory_order_acquire);
+    return wr - rd;
+}
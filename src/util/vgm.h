@@ -0,0 +1,49 @@
+/* Streams of chip register writes in the VGM format
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include "mapped_file.h"
+#include <jsl/types>
+#include <cstddef>
+
+// rate of the timestamps of the format
+static constexpr uint vgm_rate = 44100;
+
+// register write to one of a pair of OPL chips
+struct VGM_Write {
+    u32 time = 0;         // in samples at vgm_rate
+    uint chip = 0;        // 0 or 1
+    uint reg = 0;         // 9 bits, the second bank at 0x100
+    uint val = 0;
+};
+
+// save writes of YMF262 in order of time, as a stream of given length for
+// one chip or a pair. throw std::runtime_error in case of failure
+template <class = void> void vgm_save(
+    const char *path, const VGM_Write *writes, size_t count,
+    u32 length, uint chips);
+
+// reader of the OPL writes of a file, mapped in memory
+class VGM_Stream {
+public:
+    // throw std::runtime_error in case of failure
+    template <class = void> void open(const char *path);
+
+    // get the next write, false at the end
+    template <class = void> bool next(VGM_Write &wr);
+
+    // number of chips which the stream writes, 1 or 2
+    uint chips() const
+        { return chips_; }
+
+private:
+    mapped_file file_;
+    const u8 *pos_ = nullptr;
+    const u8 *end_ = nullptr;
+    u32 time_ = 0;
+    uint chips_ = 1;
+};
+
+#include "vgm.tcc"
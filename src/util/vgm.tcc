@@ -0,0 +1,188 @@
+/* Streams of chip register writes in the VGM format
+ *
+ * Copyright (C) 2018 Jean-Pierre Cimalando.
+ */
+
+#include "vgm.h"
+#include <jsl/byte_order>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+namespace vgm_detail {
+
+enum {
+    header_size = 0x80,
+    ymf262_clock = 14318180,
+    dual_chip = 0x40000000,
+};
+
+inline u32 get32(const u8 *p)
+{
+    u32 x;
+    std::memcpy(&x, p, 4);
+    return jsl::int_of_le32(x);
+}
+
+inline void put32(u8 *p, u32 v)
+{
+    v = jsl::le32_of_int(v);
+    std::memcpy(p, &v, 4);
+}
+
+// size of the command, 0 if unknown
+inline uint command_size(uint cmd, const u8 *pos, const u8 *end)
+{
+    if (cmd >= 0x30 && cmd <= 0x3f) return 2;
+    if (cmd >= 0x40 && cmd <= 0x4e) return 3;
+    if (cmd == 0x4f || cmd == 0x50) return 2;
+    if (cmd >= 0x51 && cmd <= 0x5f) return 3;
+    if (cmd == 0x61) return 3;
+    if (cmd == 0x62 || cmd == 0x63) return 1;
+    if (cmd == 0x67) {
+        // data block, 0x67 0x66 type size32
+        if (end - pos < 7)
+            return 0;
+        u32 size = get32(pos + 3) & 0x7fffffff;
+        return ((u32)(end - pos) - 7 < size) ? 0 : (7 + size);
+    }
+    if (cmd == 0x68) return 12;
+    if (cmd >= 0x70 && cmd <= 0x8f) return 1;
+    switch (cmd) {
+    case 0x90: case 0x91: case 0x95: return 5;
+    case 0x92: return 6;
+    case 0x93: return 11;
+    case 0x94: return 2;
+    }
+    if (cmd >= 0xa0 && cmd <= 0xbf) return 3;
+    if (cmd >= 0xc0 && cmd <= 0xdf) return 4;
+    if (cmd >= 0xe0) return 5;
+    return 0;
+}
+
+}  // namespace vgm_detail
+
+template <class> void vgm_save(
+    const char *path, const VGM_Write *writes, size_t count,
+    u32 length, uint chips)
+{
+    using namespace vgm_detail;
+
+    std::vector<u8> out(header_size);
+    out.reserve(header_size + 4 * count + 1);
+
+    u32 time = 0;
+    auto wait = [&out, &time](u32 until) {
+        while (time < until) {
+            u32 n = until - time;
+            if (n <= 16)
+                out.push_back(0x70 + n - 1);
+            else if (n == 735 || n == 882)
+                out.push_back((n == 735) ? 0x62 : 0x63);
+            else {
+                n = (n < 65535) ? n : 65535;
+                out.push_back(0x61);
+                out.push_back(n & 0xff);
+                out.push_back(n >> 8);
+            }
+            time += n;
+        }
+    };
+
+    for (size_t i = 0; i < count; ++i) {
+        const VGM_Write &wr = writes[i];
+        wait(wr.time);
+        uint port = (wr.reg >> 8) & 1;
+        out.push_back(((wr.chip & 1) ? 0xae : 0x5e) + port);
+        out.push_back(wr.reg & 0xff);
+        out.push_back(wr.val);
+    }
+    wait(length);
+    out.push_back(0x66);
+
+    u8 *hdr = out.data();
+    std::memcpy(hdr, "Vgm ", 4);
+    put32(hdr + 0x04, out.size() - 0x04);
+    put32(hdr + 0x08, 0x151);
+    put32(hdr + 0x18, time);
+    put32(hdr + 0x34, header_size - 0x34);
+    put32(hdr + 0x5c, ymf262_clock | ((chips > 1) ? dual_chip : 0));
+
+    std::unique_ptr<FILE, int (*)(FILE *)> fh(fopen(path, "wb"), &fclose);
+    if (!fh)
+        throw std::runtime_error("cannot open VGM file for writing");
+    if (fwrite(out.data(), 1, out.size(), fh.get()) != out.size() ||
+        fflush(fh.get()) != 0)
+        throw std::runtime_error("cannot write VGM file");
+}
+
+template <class> void VGM_Stream::open(const char *path)
+{
+    using namespace vgm_detail;
+
+    file_.open(path);
+    const u8 *data = file_.data();
+    const size_t size = file_.size();
+
+    if (size < 0x40 || std::memcmp(data, "Vgm ", 4) != 0)
+        throw std::runtime_error("not a VGM file");
+
+    u32 version = get32(data + 0x08);
+    u32 start = 0x40;
+    if (version >= 0x150 && get32(data + 0x34) != 0)
+        start = 0x34 + get32(data + 0x34);
+    u32 eof = 0x04 + get32(data + 0x04);
+    if (eof > size)
+        eof = size;
+    if (start >= eof)
+        throw std::runtime_error("invalid VGM file");
+
+    // the clocks of YM3812 and YMF262 are in the header of 1.51
+    u32 ym3812 = (version >= 0x151 && start > 0x50) ? get32(data + 0x50) : 0;
+    u32 ymf262 = (version >= 0x151 && start > 0x5c) ? get32(data + 0x5c) : 0;
+    if (!ym3812 && !ymf262)
+        throw std::runtime_error("VGM file is not for an OPL chip");
+
+    pos_ = data + start;
+    end_ = data + eof;
+    time_ = 0;
+    chips_ = ((ym3812 | ymf262) & dual_chip) ? 2 : 1;
+}
+
+template <class> bool VGM_Stream::next(VGM_Write &wr)
+{
+    while (pos_ != end_) {
+        const u8 *pos = pos_;
+        uint cmd = pos[0];
+        uint size = vgm_detail::command_size(cmd, pos, end_);
+        if (cmd == 0x66 || size == 0 || (size_t)(end_ - pos) < size)
+            break;
+        pos_ += size;
+
+        switch (cmd) {
+        // waits
+        case 0x61: time_ += pos[1] | (pos[2] << 8); break;
+        case 0x62: time_ += 735; break;
+        case 0x63: time_ += 882; break;
+        // YM3812, or YMF262 in ports 0 and 1, of the first or second chip
+        case 0x5a: case 0x5e: case 0x5f:
+        case 0xaa: case 0xae: case 0xaf:
+            wr.time = time_;
+            wr.chip = (cmd >= 0xa0) ? 1 : 0;
+            wr.reg = pos[1] | ((cmd & 0x0f) == 0x0f ? 0x100 : 0);
+            wr.val = pos[2];
+            return true;
+        default:
+            if (cmd >= 0x70 && cmd <= 0x7f)
+                time_ += (cmd & 0x0f) + 1;
+            else if (cmd >= 0x80 && cmd <= 0x8f)
+                time_ += cmd & 0x0f;
+            break;
+        }
+    }
+
+    pos_ = end_;
+    return false;
+}
@@ -0,0 +1,43 @@
+/* Pool of worker threads
+ *
+ * Copyright (C) 2017-2018 Jean-Pierre Cimalando.
+ */
+
+#pragma once
+#include <jsl/types>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// a fixed set of threads which run one job together, and synchronize at the
+// end of it. the calling thread takes part as the task of index 0.
+class worker_pool {
+public:
+    typedef void (job_function)(void *arg, uint index);
+
+    explicit worker_pool(uint nthreads);
+    ~worker_pool();
+
+    // run a job as `1 + threads()` tasks, and wait for all of them
+    void run(job_function *fn, void *arg);
+
+    uint threads() const
+        { return threads_.size(); }
+
+private:
+    void work(uint index);
+    void stop();
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_cond_;
+    std::condition_variable done_cond_;
+    job_function *fn_ = nullptr;
+    void *arg_ = nullptr;
+    u64 generation_ = 0;
+    uint pending_ = 0;
+    bool quit_ = false;
+};
+
+#include "util/worker_pool.tcc"
@@ -0,0 +1,77 @@
+#include "util/worker_pool.h"
+
+inline worker_pool::worker_pool(uint nthreads)
+{
+    threads_.reserve(nthreads);
+    try {
+        for (uint i = 0; i < nthreads; ++i)
+            threads_.emplace_back([this, i]() { work(i + 1); });
+    }
+    catch (...) {
+        stop();
+        throw;
+    }
+}
+
+inline worker_pool::~worker_pool()
+{
+    stop();
+}
+
+inline void worker_pool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        quit_ = true;
+    }
+    start_cond_.notify_all();
+    for (std::thread &t : threads_)
+        t.join();
+    threads_.clear();
+}
+
+inline void worker_pool::run(job_function *fn, void *arg)
+{
+    const uint nthreads = threads_.size();
+
+    if (nthreads > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            fn_ = fn;
+            arg_ = arg;
+            pending_ = nthreads;
+            ++generation_;
+        }
+        start_cond_.notify_all();
+    }
+
+    fn(arg, 0);
+
+    if (nthreads > 0) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cond_.wait(lock, [this]() { return pending_ == 0; });
+    }
+}
+
+inline void worker_pool::work(uint index)
+{
+    u64 generation = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;) {
+        start_cond_.wait(lock, [this, generation]() {
+            return quit_ || generation_ != generation; });
+        if (quit_)
+            break;
+        generation = generation_;
+
+        job_function *fn = fn_;
+        void *arg = arg_;
+        lock.unlock();
+        fn(arg, index);
+        lock.lock();
+
+        if (--pending_ == 0)
+            done_cond_.notify_one();
+    }
+}